@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: 2024 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+
+#include <ranges>
+#include <filesystem>
+#include <iostream>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <gridformat/gridformat.hpp>
+#include "../common.hpp"
+
+#if GRIDFORMAT_HAVE_HIGH_FIVE
+
+static constexpr int num_steps = 1000;
+static constexpr int num_repetitions = 3;
+
+template<typename Coordinate>
+double test_function(const Coordinate& position, double t) {
+    return position[0]*position[1]*t;
+}
+
+// Measure the time it takes to append all time steps, and to read the point field of all steps afterwards
+template<typename Grid>
+std::pair<std::vector<double>, std::vector<double>> measure_time_series(const Grid& grid,
+                                                                        const GridFormat::VTK::HDFTransientOptions& opts,
+                                                                        const std::string_view name) {
+    std::cout << "Measuring time series output ('" << name << "')" << std::endl;
+    const std::string filename = "benchmark_vtk_hdf_tmp";
+    const std::size_t num_points = GridFormat::number_of_points(grid);
+
+    std::vector<double> write_results;
+    std::vector<double> read_results;
+    for (int i = 0; i < num_repetitions; ++i) {
+        std::filesystem::remove(filename + ".hdf");
+
+        double t = 0.0;
+        GridFormat::VTKHDFUnstructuredTimeSeriesWriter writer{grid, filename, opts};
+        writer.set_point_field("pf", [&] (const auto& p) { return test_function(grid.position(p), t); });
+        writer.set_cell_field("cf", [&] (const auto& c) { return test_function(grid.center(c), t); });
+        write_results.push_back(GridFormat::Benchmark::measure([&] () {
+            for (int step = 0; step < num_steps; ++step) {
+                t = static_cast<double>(step);
+                writer.write(t);
+            }
+        }));
+        std::cout << " -- run " << i << " (append): " << write_results.back() << "s" << std::endl;
+
+        read_results.push_back(GridFormat::Benchmark::measure([&] () {
+            const GridFormat::HDF5::File<> file{
+                filename + ".hdf",
+                GridFormat::HDF5::File<>::read_only,
+                {.chunk_cache_size_in_bytes = opts.chunk_cache_size_in_bytes}
+            };
+            const auto offsets = file.read_dataset_to<std::vector<std::size_t>>("/VTKHDF/Steps/PointDataOffsets/pf");
+            for (const std::size_t offset : offsets) {
+                const auto values = file.read_dataset_to<std::vector<double>>(
+                    "/VTKHDF/PointData/pf",
+                    GridFormat::HDF5::Slice{.offset = {offset}, .count = {num_points}}
+                );
+                if (values.size() != num_points)
+                    throw GridFormat::SizeError("Unexpected number of values read");
+            }
+        }));
+        std::cout << " -- run " << i << " (read): " << read_results.back() << "s" << std::endl;
+    }
+
+    std::filesystem::remove(filename + ".hdf");
+    return {std::move(write_results), std::move(read_results)};
+}
+
+int main() {
+    // small pieces per step, such that the default chunks (one per step) are tiny
+    GridFormat::ImageGrid<2, double> grid{{1.0, 1.0}, {50, 50}};
+
+    const auto [default_write, default_read] = measure_time_series(
+        grid, {.static_grid = true}, "default"
+    );
+    const auto [chunked_write, chunked_read] = measure_time_series(
+        grid, {.static_grid = true, .chunk_size_in_bytes = std::size_t{4} << 20}, "chunks_4mib"
+    );
+    const auto [cached_write, cached_read] = measure_time_series(
+        grid,
+        {
+            .static_grid = true,
+            .chunk_size_in_bytes = std::size_t{4} << 20,
+            .chunk_cache_size_in_bytes = std::size_t{32} << 20
+        },
+        "chunks_4mib_cache_32mib"
+    );
+
+    GridFormat::Benchmark::write_results_to("benchmark_vtk_hdf.csv", {
+        {"default_append", default_write},
+        {"default_read", default_read},
+        {"chunked_append", chunked_write},
+        {"chunked_read", chunked_read},
+        {"cached_append", cached_write},
+        {"cached_read", cached_read}
+    });
+
+    return 0;
+}
+
+#else
+
+int main() {
+    std::cout << "Skipping benchmark as HighFive is not available" << std::endl;
+    return 0;
+}
+
+#endif  // GRIDFORMAT_HAVE_HIGH_FIVE
@@ -8,7 +8,10 @@
 #ifndef GRIDFORMAT_COMMON_BUFFER_FIELD_HPP_
 #define GRIDFORMAT_COMMON_BUFFER_FIELD_HPP_
 
+#include <span>
 #include <ranges>
+#include <cstddef>
+#include <optional>
 #include <utility>
 
 #include <gridformat/common/field.hpp>
@@ -48,6 +51,10 @@ class BufferField : public Field {
         return {Precision<T>{}};
     }
 
+    std::optional<std::span<const std::byte>> _contiguous_bytes() const {
+        return _serialization.as_span();
+    }
+
     Serialization _serialized() const {
         return _serialization;
     }
@@ -8,13 +8,17 @@
 #ifndef GRIDFORMAT_COMMON_FIELD_HPP_
 #define GRIDFORMAT_COMMON_FIELD_HPP_
 
+#include <span>
 #include <memory>
+#include <optional>
+#include <string>
 #include <cstddef>
 #include <concepts>
 #include <type_traits>
 #include <utility>
 #include <ranges>
 #include <cmath>
+#include <algorithm>
 
 #include <gridformat/common/md_layout.hpp>
 #include <gridformat/common/precision.hpp>
@@ -70,10 +74,74 @@ class Field {
         return result;
     }
 
+    /*!
+     * \brief Return a view on the field values in serialized form, if they are stored contiguously in memory.
+     * \details Allows writers to avoid copying the values into a new serialization. The view
+     *          is only valid as long as the field (and the data it refers to) is alive.
+     */
+    std::optional<std::span<const std::byte>> contiguous_bytes() const {
+        const auto result = _contiguous_bytes();
+        if (result && result->size() != size_in_bytes())
+            throw SizeError("Size of contiguous view does not match expected number of bytes");
+        return result;
+    }
+
+    /*!
+     * \brief Return the values of the given range of tuples in serialized form.
+     * \details Tuples are the sub-fields along the first dimension of the layout (e.g. the vectors
+     *          of a vector field). Fields that read from files may only read the requested values.
+     */
+    Serialization serialized_range(std::size_t first_tuple, std::size_t number_of_tuples) const {
+        const std::size_t total_number_of_tuples = _number_of_tuples();
+        if (first_tuple + number_of_tuples > total_number_of_tuples)
+            throw SizeError(
+                "Requested tuple range [" + std::to_string(first_tuple) + ", "
+                + std::to_string(first_tuple + number_of_tuples) + ") exceeds the number of tuples ("
+                + std::to_string(total_number_of_tuples) + ")"
+            );
+
+        const std::size_t tuple_size_in_bytes = _tuple_size_in_bytes();
+        Serialization result{number_of_tuples*tuple_size_in_bytes};
+        if (number_of_tuples > 0)
+            _serialize_bytes_into(first_tuple*tuple_size_in_bytes, result.as_span());
+        return result;
+    }
+
+    /*!
+     * \brief Write the serialized bytes [offset, offset + out.size()) into the given buffer.
+     * \details Allows writers to process large fields in chunks with a buffer of fixed size. Fields
+     *          that support this only evaluate (or read) the values that lie within the requested range.
+     */
+    void serialize_bytes_into(std::size_t offset, std::span<std::byte> out) const {
+        const std::size_t total_size = size_in_bytes();
+        if (offset + out.size() > total_size)
+            throw SizeError(
+                "Requested byte range [" + std::to_string(offset) + ", "
+                + std::to_string(offset + out.size()) + ") exceeds the field size ("
+                + std::to_string(total_size) + ")"
+            );
+        if (out.empty())
+            return;
+
+        // implementations only receive ranges of full tuples
+        const std::size_t tuple_size_in_bytes = _tuple_size_in_bytes();
+        const std::size_t end = offset + out.size();
+        const std::size_t aligned_begin = offset - offset%tuple_size_in_bytes;
+        const std::size_t aligned_end = end%tuple_size_in_bytes ? end + tuple_size_in_bytes - end%tuple_size_in_bytes : end;
+        if (aligned_begin == offset && aligned_end == end)
+            return _serialize_bytes_into(offset, out);
+
+        Serialization tuples{aligned_end - aligned_begin};
+        _serialize_bytes_into(aligned_begin, tuples.as_span());
+        std::ranges::copy(tuples.as_span().subspan(offset - aligned_begin, out.size()), out.begin());
+    }
+
     //! Visit the scalar values of the field in the form of an std::span
     template<typename Visitor>
     decltype(auto) visit_field_values(Visitor&& visitor) const {
         return precision().visit([&] <typename T> (const Precision<T>&) {
+            if (const auto bytes = contiguous_bytes())
+                return visitor(std::span{reinterpret_cast<const T*>(bytes->data()), bytes->size()/sizeof(T)});
             const auto serialization = serialized();
             return visitor(serialization.template as_span_of<T>());
         });
@@ -119,6 +187,44 @@ class Field {
         return export_to(R{});
     }
 
+ protected:
+    /*!
+     * \brief Write the serialized bytes [offset, offset + out.size()) into the given buffer (overload
+     *        to serialize ranges of values without serializing the entire field).
+     * \note The offset and the buffer size are guaranteed to be multiples of the size of a tuple.
+     */
+    virtual void _serialize_bytes_into(std::size_t offset, std::span<std::byte> out) const {
+        if (const auto bytes = contiguous_bytes()) {
+            std::ranges::copy(bytes->subspan(offset, out.size()), out.begin());
+            return;
+        }
+        const auto serialization = serialized();
+        std::ranges::copy(serialization.as_span().subspan(offset, out.size()), out.begin());
+    }
+
+    //! Return a view on the serialized values if they are contiguous in memory (overload to avoid copies)
+    virtual std::optional<std::span<const std::byte>> _contiguous_bytes() const {
+        return std::nullopt;
+    }
+
+    //! Write all serialized bytes into the given buffer (overload to avoid intermediate copies)
+    virtual void _serialize_into(std::span<std::byte> out) const {
+        if (!out.empty())
+            _serialize_bytes_into(0, out);
+    }
+
+    //! Return the number of tuples along the first dimension of the layout
+    std::size_t _number_of_tuples() const {
+        const auto my_layout = layout();
+        return my_layout.dimension() > 0 ? my_layout.extent(0) : 1;
+    }
+
+    //! Return the size of a tuple in serialized form
+    std::size_t _tuple_size_in_bytes() const {
+        const std::size_t number_of_tuples = _number_of_tuples();
+        return number_of_tuples > 0 ? size_in_bytes()/number_of_tuples : 0;
+    }
+
  private:
     DynamicPrecision _prec;
 
@@ -155,6 +261,15 @@ class Field {
                 );
         }
 
+        // write directly into the memory of contiguous ranges of matching precision
+        if constexpr (_is_writable_contiguous_scalar_range<std::remove_cvref_t<R>>()) {
+            using T = MDRangeValueType<std::remove_cvref_t<R>>;
+            if (precision() == DynamicPrecision{Precision<T>{}}) {
+                _serialize_into(std::as_writable_bytes(std::span{output_range}).first(size_in_bytes()));
+                return std::forward<R>(output_range);
+            }
+        }
+
         std::size_t offset = 0;
         visit_field_values([&] <typename T> (std::span<const T> data) {
             _export_to(output_range, data, offset);
@@ -163,6 +278,13 @@ class Field {
         return std::forward<R>(output_range);
     }
 
+    template<typename R>
+    static constexpr bool _is_writable_contiguous_scalar_range() {
+        if constexpr (is_contiguous_scalar_range<R>)
+            return std::is_same_v<std::ranges::range_reference_t<R>, std::ranges::range_value_t<R>&>;
+        return false;
+    }
+
     template<std::ranges::range R, Concepts::Scalar T>
     void _export_to(R& range,
                     std::span<const T> data,
@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Common
+ * \copydoc GridFormat::FieldCache
+ */
+#ifndef GRIDFORMAT_COMMON_FIELD_CACHE_HPP_
+#define GRIDFORMAT_COMMON_FIELD_CACHE_HPP_
+
+#include <list>
+#include <mutex>
+#include <memory>
+#include <string>
+#include <utility>
+#include <cstddef>
+#include <concepts>
+#include <functional>
+#include <unordered_map>
+
+#include <gridformat/common/serialization.hpp>
+
+namespace GridFormat {
+
+/*!
+ * \ingroup Common
+ * \brief Identifies the data of a field that was read from a file.
+ */
+struct FieldCacheKey {
+    std::string file;       //!< The file from which the data is read
+    std::string array;      //!< Identifier of the data array within the file
+    std::size_t step = 0;   //!< The step (for files that contain time series)
+
+    friend bool operator==(const FieldCacheKey&, const FieldCacheKey&) = default;
+};
+
+/*!
+ * \ingroup Common
+ * \brief Statistics about the usage of a FieldCache.
+ */
+struct FieldCacheStatistics {
+    std::size_t hits = 0;                //!< Number of requests served from the cache
+    std::size_t misses = 0;              //!< Number of requests for which the data had to be read
+    std::size_t evictions = 0;           //!< Number of entries that were evicted to respect the byte budget
+    std::size_t number_of_entries = 0;   //!< Number of entries currently in the cache
+    std::size_t size_in_bytes = 0;       //!< Number of bytes currently held in the cache
+};
+
+/*!
+ * \ingroup Common
+ * \brief Cache for the (decoded) data of fields read from files, with a limited budget of bytes.
+ * \details If the budget would be exceeded by a new entry, the least-recently used entries are
+ *          evicted. Data that is larger than the budget is not cached. The cache can be used from
+ *          multiple threads concurrently.
+ */
+class FieldCache {
+    struct Entry {
+        FieldCacheKey key;
+        std::shared_ptr<const Serialization> data;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const FieldCacheKey& key) const {
+            std::size_t h = std::hash<std::string>{}(key.file);
+            h ^= std::hash<std::string>{}(key.array) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            h ^= std::hash<std::size_t>{}(key.step) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            return h;
+        }
+    };
+
+ public:
+    explicit FieldCache(std::size_t byte_budget)
+    : _byte_budget{byte_budget}
+    {}
+
+    /*!
+     * \brief Return the data cached for the given key, or read it with the given function and cache it.
+     * \note The data is read outside of the lock, so concurrent requests for the same (uncached) key
+     *       may read the data more than once.
+     */
+    template<std::invocable Reader>
+        requires(std::convertible_to<std::invoke_result_t<Reader>, Serialization>)
+    Serialization get_or_insert(const FieldCacheKey& key, const Reader& read) {
+        if (auto cached = _find(key))
+            return *cached;
+
+        Serialization data = read();
+        _insert(key, data);
+        return data;
+    }
+
+    //! Return true if data is cached for the given key (does not count as access)
+    bool contains(const FieldCacheKey& key) const {
+        std::lock_guard lock{_mutex};
+        return _entries.contains(key);
+    }
+
+    //! Remove all entries from the cache
+    void clear() {
+        std::lock_guard lock{_mutex};
+        _entries.clear();
+        _lru.clear();
+        _statistics.number_of_entries = 0;
+        _statistics.size_in_bytes = 0;
+    }
+
+    //! Return the maximum number of bytes held in the cache
+    std::size_t byte_budget() const {
+        return _byte_budget;
+    }
+
+    //! Return statistics about the usage of this cache
+    FieldCacheStatistics statistics() const {
+        std::lock_guard lock{_mutex};
+        return _statistics;
+    }
+
+ private:
+    std::shared_ptr<const Serialization> _find(const FieldCacheKey& key) {
+        std::lock_guard lock{_mutex};
+        const auto it = _entries.find(key);
+        if (it == _entries.end()) {
+            _statistics.misses++;
+            return nullptr;
+        }
+
+        _statistics.hits++;
+        _lru.splice(_lru.begin(), _lru, it->second);
+        return it->second->data;
+    }
+
+    void _insert(const FieldCacheKey& key, const Serialization& data) {
+        const std::size_t size = data.size();
+        if (size > _byte_budget)
+            return;
+
+        auto entry_data = std::make_shared<const Serialization>(data);
+        std::lock_guard lock{_mutex};
+        if (_entries.contains(key))
+            return;
+
+        while (_statistics.size_in_bytes + size > _byte_budget) {
+            _statistics.size_in_bytes -= _lru.back().data->size();
+            _statistics.evictions++;
+            _entries.erase(_lru.back().key);
+            _lru.pop_back();
+        }
+
+        _lru.push_front(Entry{key, std::move(entry_data)});
+        _entries.emplace(key, _lru.begin());
+        _statistics.size_in_bytes += size;
+        _statistics.number_of_entries = _entries.size();
+    }
+
+    std::size_t _byte_budget;
+    std::list<Entry> _lru;
+    std::unordered_map<FieldCacheKey, std::list<Entry>::iterator, KeyHash> _entries;
+    FieldCacheStatistics _statistics;
+    mutable std::mutex _mutex;
+};
+
+}  // namespace GridFormat
+
+#endif  // GRIDFORMAT_COMMON_FIELD_CACHE_HPP_
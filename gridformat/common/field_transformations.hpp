@@ -8,7 +8,10 @@
 #ifndef GRIDFORMAT_COMMON_FIELD_TRANSFORMATIONS_HPP_
 #define GRIDFORMAT_COMMON_FIELD_TRANSFORMATIONS_HPP_
 
+#include <span>
 #include <vector>
+#include <cstddef>
+#include <optional>
 #include <utility>
 #include <concepts>
 #include <algorithm>
@@ -168,9 +171,17 @@ class IdentityField : public Field {
         return _field->precision();
     }
 
+    std::optional<std::span<const std::byte>> _contiguous_bytes() const override {
+        return _field->contiguous_bytes();
+    }
+
     Serialization _serialized() const override {
         return _field->serialized();
     }
+
+    void _serialize_bytes_into(std::size_t offset, std::span<std::byte> out) const override {
+        _field->serialize_bytes_into(offset, out);
+    }
 };
 
 /*!
@@ -194,9 +205,17 @@ class FlattenedField : public Field {
         return _field->precision();
     }
 
+    std::optional<std::span<const std::byte>> _contiguous_bytes() const override {
+        return _field->contiguous_bytes();
+    }
+
     Serialization _serialized() const override {
         return _field->serialized();
     }
+
+    void _serialize_bytes_into(std::size_t offset, std::span<std::byte> out) const override {
+        _field->serialize_bytes_into(offset, out);
+    }
 };
 
 /*!
@@ -230,9 +249,17 @@ class ReshapedField : public Field {
         return _field->precision();
     }
 
+    std::optional<std::span<const std::byte>> _contiguous_bytes() const override {
+        return _field->contiguous_bytes();
+    }
+
     Serialization _serialized() const override {
         return _field->serialized();
     }
+
+    void _serialize_bytes_into(std::size_t offset, std::span<std::byte> out) const override {
+        _field->serialize_bytes_into(offset, out);
+    }
 };
 
 /*!
@@ -307,6 +334,36 @@ class ExtendedField : public Field {
         return serialization;
     }
 
+    // serializes the requested tuples of the original field and places their values into the extended tuples
+    void _serialize_bytes_into(std::size_t offset, std::span<std::byte> out) const override {
+        const auto orig_layout = _field->layout();
+        const auto new_layout = _extended_layout(orig_layout);
+        if (orig_layout == new_layout)
+            return _field->serialize_bytes_into(offset, out);
+
+        const auto orig_sub_layout = orig_layout.sub_layout(1);
+        const auto new_sub_layout = new_layout.sub_layout(1);
+        std::vector<std::size_t> target_indices(orig_sub_layout.number_of_entries());
+        FieldTransformationDetail::BackwardsMDIndexMapWalk index_walk{orig_sub_layout, new_sub_layout};
+        while (!index_walk.is_finished()) {
+            target_indices[index_walk.source_index_flat()] = index_walk.target_index_flat();
+            index_walk.next();
+        }
+
+        _field->precision().visit([&] <typename T> (const Precision<T>&) {
+            const std::size_t new_tuple_size = new_sub_layout.number_of_entries();
+            const std::size_t first_tuple = offset/(new_tuple_size*sizeof(T));
+            const std::size_t number_of_tuples = out.size()/(new_tuple_size*sizeof(T));
+            const auto in = _field->serialized_range(first_tuple, number_of_tuples);
+            const auto in_values = in.template as_span_of<T>();
+            const std::span out_values{reinterpret_cast<T*>(out.data()), out.size()/sizeof(T)};
+            std::ranges::fill(out, std::byte{0});
+            for (std::size_t tuple = 0; tuple < number_of_tuples; ++tuple)
+                for (std::size_t i = 0; i < target_indices.size(); ++i)
+                    out_values[tuple*new_tuple_size + target_indices[i]] = in_values[tuple*target_indices.size() + i];
+        });
+    }
+
     void _check_valid_layout(const MDLayout& orig, const std::vector<std::size_t>& extents) const {
         if (std::ranges::any_of(
             std::views::iota(std::size_t{0}, orig.dimension()),
@@ -458,6 +515,23 @@ class MergedField : public Field {
         return result;
     }
 
+    void _serialize_bytes_into(std::size_t offset, std::span<std::byte> out) const override {
+        std::size_t field_offset = 0;
+        for (const FieldPtr& field : _fields) {
+            const std::size_t field_size = field->size_in_bytes();
+            if (out.empty())
+                break;
+            if (offset < field_offset + field_size) {
+                const std::size_t local_offset = offset - field_offset;
+                const std::size_t number_of_bytes = std::min(field_size - local_offset, out.size());
+                field->serialize_bytes_into(local_offset, out.first(number_of_bytes));
+                out = out.subspan(number_of_bytes);
+                offset += number_of_bytes;
+            }
+            field_offset += field_size;
+        }
+    }
+
     DynamicPrecision _precision() const override {
         return _fields.front()->precision();
     }
@@ -630,9 +704,17 @@ class TransformedField : public Field {
         return _transformed->precision();
     }
 
+    std::optional<std::span<const std::byte>> _contiguous_bytes() const override {
+        return _transformed->contiguous_bytes();
+    }
+
     Serialization _serialized() const override {
         return _transformed->serialized();
     }
+
+    void _serialize_bytes_into(std::size_t offset, std::span<std::byte> out) const override {
+        _transformed->serialize_bytes_into(offset, out);
+    }
 };
 
 }  // namespace GridFormat
@@ -9,11 +9,18 @@
 #define GRIDFORMAT_COMMON_HDF5_HPP_
 #if GRIDFORMAT_HAVE_HIGH_FIVE
 
+#include <span>
+#include <vector>
+#include <cstddef>
 #include <type_traits>
 #include <algorithm>
 #include <concepts>
 #include <ranges>
 #include <cstdint>
+#include <numeric>
+#include <optional>
+#include <functional>
+#include <string>
 
 #ifdef GRIDFORMAT_DISABLE_HIGHFIVE_WARNINGS
 #pragma GCC diagnostic push
@@ -60,12 +67,23 @@ namespace Detail {
     }
 
     template<Concepts::Communicator Communicator>
-    auto parallel_file_access_props([[maybe_unused]] const Communicator& communicator) {
+    auto parallel_file_access_props([[maybe_unused]] const Communicator& communicator,
+                                    [[maybe_unused]] std::size_t aggregators_per_node = 0) {
         HighFive::FileAccessProps fapl;
 #if GRIDFORMAT_HAVE_PARALLEL_HIGH_FIVE
         if constexpr (!std::is_same_v<Communicator, NullCommunicator>) {
-            fapl.add(HighFive::MPIOFileAccess{communicator, MPI_INFO_NULL});
+            // let MPI-IO route the data of collective writes through the given number of ranks per node
+            MPI_Info info = MPI_INFO_NULL;
+            if (aggregators_per_node > 0) {
+                const std::string config_list = "*:" + std::to_string(aggregators_per_node);
+                MPI_Info_create(&info);
+                MPI_Info_set(info, "romio_cb_write", "enable");
+                MPI_Info_set(info, "cb_config_list", config_list.c_str());
+            }
+            fapl.add(HighFive::MPIOFileAccess{communicator, info});
             fapl.add(HighFive::MPIOCollectiveMetadata{});
+            if (info != MPI_INFO_NULL)
+                MPI_Info_free(&info);  // the property list holds a copy
         } else {
             throw TypeError("Cannot establish parallel I/O with null communicator");
         }
@@ -112,6 +130,48 @@ struct Slice {
     std::optional<std::vector<std::size_t>> total_size = {};
 };
 
+/*!
+ * \brief A filter that is applied to the chunks of datasets.
+ * \details Filters are identified by their registered id (see https://github.com/HDFGroup/hdf5_plugins),
+ *          and they are only used if they are available (e.g. if the respective plugin can be loaded).
+ */
+struct Filter {
+    unsigned int id;                             //!< The registered id of the filter
+    std::vector<unsigned int> parameters = {};   //!< Parameters passed to the filter (e.g. the compression level)
+
+    //! Zstandard compression at the given level (requires the plugin)
+    static Filter zstd(unsigned int level = 3) { return {.id = 32015, .parameters = {level}}; }
+    //! LZ4 compression (requires the plugin)
+    static Filter lz4() { return {.id = 32004}; }
+};
+
+/*!
+ * \brief Options for the creation of datasets.
+ * \details Datasets to which data is appended, and datasets to which filters are applied, are stored in
+ *          chunks, which consist of the given number of entries along the first dimension (and the full
+ *          extents in all other dimensions). If no chunk size is specified, it is derived from the target
+ *          chunk size in bytes. Without a target size, filtered datasets use chunks of about one megabyte,
+ *          while unfiltered appended datasets use chunks with the extents of the first append.
+ *          In parallel I/O, filters are only used for datasets that are written collectively, since
+ *          HDF5 does not support independent writes into filtered datasets. In collective parallel writes,
+ *          the data can be gathered on a number of aggregator ranks per compute node that access the
+ *          file on behalf of all ranks (collective buffering of MPI-IO).
+ */
+struct DataSetOptions {
+    std::size_t chunk_size = 0;                      //!< Extent of the chunks along the first dimension (0 = automatic)
+    std::size_t chunk_size_in_bytes = 0;             //!< Target size of the chunks if no extent is given (0 = automatic)
+    bool chunks_span_appends = true;                 //!< Allow chunks of appended datasets to exceed the extent of the first append
+    std::size_t chunk_cache_size_in_bytes = 0;       //!< Size of the raw data chunk cache per dataset (0 = HDF5 default)
+    bool shuffle = false;                            //!< Shuffle the bytes of the values (improves compression)
+    std::optional<unsigned int> deflate_level = {};  //!< Compress with deflate (zlib) at the given level (0-9)
+    std::vector<Filter> filters = {};                //!< Further filters applied after shuffle & deflate
+    std::size_t aggregators_per_node = 0;            //!< Number of ranks per node performing the collective parallel writes (0 = MPI-IO default)
+
+    bool uses_filters() const {
+        return shuffle || deflate_level.has_value() || !filters.empty();
+    }
+};
+
 //! Custom string data type using ascii encoding.
 //! HighFive uses UTF-8, but VTKHDF, for instance, uses ascii.
 struct AsciiString : public HighFive::DataType {
@@ -154,17 +214,34 @@ class File {
         read_only   //!< only read data
     };
 
-    File(const std::string& filename, Mode mode = Mode::read_only)
+    File(const std::string& filename,
+         Mode mode = Mode::read_only,
+         DataSetOptions opts = {})
         requires(std::same_as<Communicator, NullCommunicator>)
-    : File(filename, NullCommunicator{}, mode)
+    : File(filename, NullCommunicator{}, mode, std::move(opts))
     {}
 
-    File(const std::string& filename, const Communicator& comm, Mode mode = Mode::read_only)
+    File(const std::string& filename,
+         const Communicator& comm,
+         Mode mode = Mode::read_only,
+         DataSetOptions opts = {})
     : _comm{comm}
     , _mode{mode}
-    , _file{_open(filename)}
+    , _file{_open(filename, opts)}
+    , _dataset_opts{std::move(opts)}
     {}
 
+    //! Set whether the file is flushed after each write (default: true)
+    void set_flush_after_write(bool value) {
+        _flush_after_write = value;
+    }
+
+    //! Flush all buffered data and metadata to the file
+    void flush() {
+        _check_writable();
+        _file.flush();
+    }
+
     //! Clear the contents of the file with the given name
     static void clear(const std::string& filename, const Communicator& comm) {
         if (Parallel::rank(comm) == 0)  // clear file by open it in overwrite mode
@@ -205,7 +282,7 @@ class File {
         const auto space = slice ? HighFive::DataSpace{slice->total_size.value()}
                                  : HighFive::DataSpace::From(values);
         auto group = _get_group(group_name);
-        auto [offset, dataset] = _prepare_dataset<FieldScalar<Values>>(group, ds_name, space);
+        auto [offset, dataset] = _prepare_dataset<FieldScalar<Values>>(group, ds_name, space, _use_filters(slice));
         Slice _slice{
             .offset = slice ? slice->offset : std::vector<std::size_t>(space.getNumberDimensions(), 0),
             .count = slice ? slice->count : space.getDimensions()
@@ -223,7 +300,8 @@ class File {
         } else {
             _write_to(dataset, values, _slice);
         }
-        _file.flush();
+        if (_flush_after_write)
+            _file.flush();
     }
 
     //! Write a field into the dataset with the given path
@@ -243,28 +321,28 @@ class File {
         const auto [group_name, ds_name] = Detail::split_group(path);
         auto group = _get_group(group_name);
         field.precision().visit([&] <typename T> (const Precision<T>&) {
-            auto [offset, dataset] = _prepare_dataset<T>(group, ds_name, space);
+            auto [offset, dataset] = _prepare_dataset<T>(group, ds_name, space, _use_filters(slice));
             Slice _slice{
                 .offset = slice ? slice->offset : std::vector<std::size_t>(space.getNumberDimensions(), 0),
                 .count = slice ? slice->count : space.getDimensions()
             };
             _slice.offset.at(0) += offset;
 
-            const auto serialization = field.serialized();
-            const std::span<const T> span = serialization.template as_span_of<T>();
-
             if (Parallel::size(_comm) > 1) {
-                if (slice) {  // collective I/O
+                if (slice) {  // collective I/O (requires the same number of write calls on all ranks)
                     const auto props = Detail::parallel_transfer_props();
-                    _write_to(dataset, span.data(), _slice, props);
+                    field.visit_field_values([&] <typename V> (std::span<const V> span) {
+                        _write_to(dataset, span.data(), _slice, props);
+                    });
                     Detail::check_successful_collective_io(props);
                 } else if (Parallel::rank(_comm) == 0) {  // write only on rank 0 to avoid clashes
-                    _write_to(dataset, span.data(), _slice);
+                    _write_chunked_to<T>(dataset, field, _slice);
                 }
             } else {
-                _write_to(dataset, span.data(), _slice);
+                _write_chunked_to<T>(dataset, field, _slice);
             }
-            _file.flush();
+            if (_flush_after_write)
+                _file.flush();
         });
     }
 
@@ -287,12 +365,10 @@ class File {
             throw ValueError("Given data set '" + path + "' does not exist.");
 
         auto [group, name] = Detail::split_group(path);
+        const auto dataset = _file.getGroup(group).getDataSet(name, _make_access_props());
         if (slice)
-            return _visit_data(
-                std::forward<Visitor>(visitor),
-                _file.getGroup(group).getDataSet(name).select(slice->offset, slice->count)
-            );
-        return _visit_data(std::forward<Visitor>(visitor), _file.getGroup(group).getDataSet(name));
+            return _visit_data(std::forward<Visitor>(visitor), dataset.select(slice->offset, slice->count));
+        return _visit_data(std::forward<Visitor>(visitor), dataset);
     }
 
     //! Read attribute values into an instance of the given T
@@ -375,25 +451,42 @@ class File {
             throw InvalidState("Cannot modify hdf-file opened in read-only mode");
     }
 
-    HighFive::File _open(const std::string& filename) const {
+    HighFive::File _open(const std::string& filename, const DataSetOptions& opts) const {
         auto open_mode = _mode == read_only ? HighFive::File::ReadOnly
                                             : (_mode == overwrite ? HighFive::File::Overwrite
                                                                   : HighFive::File::ReadWrite);
         if (Parallel::size(_comm) > 1)
-            return HighFive::File{filename, open_mode, Detail::parallel_file_access_props(_comm)};
+            return HighFive::File{
+                filename, open_mode, Detail::parallel_file_access_props(_comm, opts.aggregators_per_node)
+            };
         else
             return HighFive::File{filename, open_mode};
     }
 
+    // filtered datasets can only be written collectively in parallel I/O
+    bool _use_filters(const std::optional<Slice>& slice) const {
+        return _dataset_opts.uses_filters() && (Parallel::size(_comm) == 1 || slice.has_value());
+    }
+
     template<typename T>
     auto _prepare_dataset(HighFive::Group& group,
                           const std::string& name,
-                          const HighFive::DataSpace& space) {
-        if (_mode == overwrite)
+                          const HighFive::DataSpace& space,
+                          bool use_filters) {
+        if (_mode == overwrite) {
+            const auto dimensions = space.getDimensions();
+            if (use_filters && _is_chunkable(dimensions))
+                return std::make_pair(
+                    std::size_t{0},
+                    group.createDataSet(
+                        name, space, HighFive::create_datatype<T>(),
+                        _make_create_props<T>(dimensions, true), _make_access_props()
+                    )
+                );
             return std::make_pair(std::size_t{0}, group.createDataSet(name, space, HighFive::create_datatype<T>()));
-        else if (_mode == append) {
+        } else if (_mode == append) {
             if (group.exist(name)) {
-                auto dataset = group.getDataSet(name);
+                auto dataset = group.getDataSet(name, _make_access_props());
                 auto out_dimensions = dataset.getDimensions();
                 const auto in_dimensions = space.getDimensions();
 
@@ -416,7 +509,6 @@ class File {
                 if (init_dimensions.size() < 1)
                     throw ValueError("Scalars cannot be written in appended mode. Wrap them in std::array{scalar}");
 
-                const auto chunk_dimensions = std::vector<hsize_t>{init_dimensions.begin(), init_dimensions.end()};
                 const auto max_dimensions = [&] () {
                     auto tmp = init_dimensions;
                     tmp[0] *= HighFive::DataSpace::UNLIMITED;
@@ -424,11 +516,13 @@ class File {
                 } ();
 
                 HighFive::DataSpace out_space(init_dimensions, max_dimensions);
-                HighFive::DataSetCreateProps props;
-                props.add(HighFive::Chunking(chunk_dimensions));
                 return std::make_pair(
                     std::size_t{0},
-                    group.createDataSet(name, out_space, HighFive::create_datatype<T>(), props)
+                    group.createDataSet(
+                        name, out_space, HighFive::create_datatype<T>(),
+                        _make_create_props<T>(init_dimensions, use_filters),
+                        _make_access_props()
+                    )
                 );
             }
         } else {
@@ -436,6 +530,70 @@ class File {
         }
     }
 
+    bool _is_chunkable(const std::vector<std::size_t>& dimensions) const {
+        return !dimensions.empty() && std::ranges::all_of(dimensions, [] (std::size_t d) { return d > 0; });
+    }
+
+    // chunks span the full extents in all but the first dimension
+    template<typename T>
+    std::vector<hsize_t> _make_chunk_dimensions(const std::vector<std::size_t>& dimensions, bool use_filters) const {
+        std::vector<hsize_t> chunk_dimensions{dimensions.begin(), dimensions.end()};
+        std::ranges::for_each(chunk_dimensions, [] (hsize_t& d) { d = std::max(d, hsize_t{1}); });
+
+        static constexpr std::size_t automatic_chunk_size_in_bytes = std::size_t{1} << 20;
+        const std::size_t target_chunk_size_in_bytes = _dataset_opts.chunk_size_in_bytes > 0
+            ? _dataset_opts.chunk_size_in_bytes
+            : (use_filters ? automatic_chunk_size_in_bytes : 0);
+        if (_dataset_opts.chunk_size == 0 && target_chunk_size_in_bytes == 0)
+            return chunk_dimensions;
+
+        const std::size_t tuple_size_in_bytes = std::accumulate(
+            chunk_dimensions.begin() + 1, chunk_dimensions.end(), sizeof(T), std::multiplies{}
+        );
+        const std::size_t chunk_size = _dataset_opts.chunk_size > 0
+            ? _dataset_opts.chunk_size
+            : std::max(target_chunk_size_in_bytes/tuple_size_in_bytes, std::size_t{1});
+        const bool span_appends = _mode == append && _dataset_opts.chunks_span_appends;
+        chunk_dimensions[0] = span_appends ? chunk_size : std::min<hsize_t>(chunk_size, chunk_dimensions[0]);
+        return chunk_dimensions;
+    }
+
+    HighFive::DataSetAccessProps _make_access_props() const {
+        // prime number of hash table slots, as recommended by the HDF5 documentation
+        static constexpr std::size_t number_of_cache_slots = 12421;
+        HighFive::DataSetAccessProps props;
+        if (_dataset_opts.chunk_cache_size_in_bytes > 0)
+            props.add(HighFive::Caching{number_of_cache_slots, _dataset_opts.chunk_cache_size_in_bytes});
+        return props;
+    }
+
+    template<typename T>
+    HighFive::DataSetCreateProps _make_create_props(const std::vector<std::size_t>& dimensions, bool use_filters) const {
+        HighFive::DataSetCreateProps props;
+        props.add(HighFive::Chunking(_make_chunk_dimensions<T>(dimensions, use_filters)));
+        if (!use_filters)
+            return props;
+
+        if (_dataset_opts.shuffle)
+            props.add(HighFive::Shuffle{});
+        if (_dataset_opts.deflate_level)
+            props.add(HighFive::Deflate{_dataset_opts.deflate_level.value()});
+        std::ranges::for_each(_dataset_opts.filters, [&] (const Filter& filter) {
+            if (H5Zfilter_avail(static_cast<H5Z_filter_t>(filter.id)) <= 0) {
+                log_warning("HDF5 filter with id " + std::to_string(filter.id) + " is not available and is skipped\n");
+                return;
+            }
+            if (H5Pset_filter(
+                    props.getId(),
+                    static_cast<H5Z_filter_t>(filter.id),
+                    H5Z_FLAG_OPTIONAL,
+                    filter.parameters.size(),
+                    filter.parameters.data()) < 0)
+                throw IOError("Could not add HDF5 filter with id " + std::to_string(filter.id));
+        });
+        return props;
+    }
+
     template<typename Values>
     void _write_to(HighFive::DataSet& dataset,
                    const Values& values,
@@ -454,6 +612,36 @@ class File {
               : dataset.select(slice.offset, slice.count).write_raw(buffer, dataset.getDataType());
     }
 
+    // Writes the field into the given slice. Fields that are not contiguous in memory are
+    // serialized and written in chunks of tuples, such that they are never copied as a whole.
+    template<Concepts::Scalar T>
+    void _write_chunked_to(HighFive::DataSet& dataset, const Field& field, const Slice& slice) {
+        static constexpr std::size_t chunk_size_in_bytes = std::size_t{1} << 22;
+
+        if (const auto bytes = field.contiguous_bytes())
+            return _write_to(dataset, reinterpret_cast<const T*>(bytes->data()), slice);
+        if (slice.count.empty() || slice.count[0] == 0 || field.size_in_bytes() <= chunk_size_in_bytes)
+            return field.visit_field_values([&] <typename V> (std::span<const V> span) {
+                _write_to(dataset, span.data(), slice);
+            });
+
+        const std::size_t number_of_tuples = slice.count[0];
+        const std::size_t tuple_size_in_bytes = field.size_in_bytes()/number_of_tuples;
+        const std::size_t tuples_per_chunk = std::max(chunk_size_in_bytes/tuple_size_in_bytes, std::size_t{1});
+        std::vector<T> buffer(tuples_per_chunk*tuple_size_in_bytes/sizeof(T));
+        Slice chunk_slice = slice;
+        for (std::size_t first = 0; first < number_of_tuples; first += tuples_per_chunk) {
+            const std::size_t count = std::min(tuples_per_chunk, number_of_tuples - first);
+            field.serialize_bytes_into(
+                first*tuple_size_in_bytes,
+                std::as_writable_bytes(std::span{buffer}).first(count*tuple_size_in_bytes)
+            );
+            chunk_slice.offset[0] = slice.offset[0] + first;
+            chunk_slice.count[0] = count;
+            _write_to(dataset, buffer.data(), chunk_slice);
+        }
+    }
+
     template<typename Visitor, typename Source>
     decltype(auto) _visit_data(Visitor&& visitor, const Source& source) const {
         const auto datatype = source.getDataType();
@@ -519,6 +707,8 @@ class File {
     Communicator _comm;
     Mode _mode;
     HighFive::File _file;
+    DataSetOptions _dataset_opts;
+    bool _flush_after_write = true;
 };
 
 }  // namespace GridFormat::HDF5
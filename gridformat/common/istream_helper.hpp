@@ -161,6 +161,14 @@ class InputStreamHelper {
             throw SizeError("Given position is beyond EOF");
     }
 
+    //! Jump to the end of the stream
+    void seek_end() {
+        _stream.clear();
+        _stream.seekg(0, std::ios::end);
+        if (_stream.fail())
+            throw IOError("Could not seek the end of the stream");
+    }
+
     //! Return true if no more characters can be read from the stream
     bool is_end_of_file() {
         _stream.peek();
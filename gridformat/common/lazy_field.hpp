@@ -8,7 +8,10 @@
 #ifndef GRIDFORMAT_COMMON_LAZY_FIELD_HPP_
 #define GRIDFORMAT_COMMON_LAZY_FIELD_HPP_
 
+#include <span>
 #include <utility>
+#include <cstddef>
+#include <functional>
 #include <concepts>
 #include <type_traits>
 
@@ -29,6 +32,7 @@ class LazyField : public Field {
     using SourceType = std::remove_cvref_t<S>;
     using SourceReferenceType = std::add_lvalue_reference_t<std::add_const_t<SourceType>>;
     using SerializationCallBack = std::function<Serialization(SourceReferenceType)>;
+    using SerializeIntoCallBack = std::function<void(SourceReferenceType, std::size_t, std::span<std::byte>)>;
 
     template<typename _S, typename CallBack>
         requires(std::constructible_from<SerializationCallBack, CallBack> and
@@ -43,6 +47,25 @@ class LazyField : public Field {
     , _serialization_callback{std::forward<CallBack>(cb)}
     {}
 
+    /*!
+     * \brief Constructor with an additional callback that writes serialized values into a given buffer.
+     * \details The callback receives the source, the offset of the first byte to be written, and the
+     *          output buffer. It is used to read ranges of the values, or to read the values directly
+     *          into the memory of the ranges they are exported to.
+     */
+    template<typename _S, typename CallBack, typename IntoCallBack>
+        requires(std::constructible_from<SerializationCallBack, CallBack> and
+                 std::constructible_from<SerializeIntoCallBack, IntoCallBack> and
+                 std::convertible_to<_S, S>)
+    explicit LazyField(_S&& source,
+                       MDLayout layout,
+                       DynamicPrecision prec,
+                       CallBack&& cb,
+                       IntoCallBack&& into_cb)
+    : LazyField(std::forward<_S>(source), std::move(layout), std::move(prec), std::forward<CallBack>(cb)) {
+        _serialize_into_callback = std::forward<IntoCallBack>(into_cb);
+    }
+
  private:
     MDLayout _layout() const override {
         return _md_layout;
@@ -56,10 +79,17 @@ class LazyField : public Field {
         return _serialization_callback(_source);
     }
 
+    void _serialize_bytes_into(std::size_t offset, std::span<std::byte> out) const override {
+        if (!_serialize_into_callback)
+            return Field::_serialize_bytes_into(offset, out);
+        _serialize_into_callback(_source, offset, out);
+    }
+
     S _source;
     MDLayout _md_layout;
     DynamicPrecision _scalar_precision;
     SerializationCallBack _serialization_callback;
+    SerializeIntoCallBack _serialize_into_callback;
 };
 
 template<typename S, typename CB>
@@ -71,6 +101,15 @@ LazyField(S&&, MDLayout, DynamicPrecision, CB&&) -> LazyField<
     >
 >;
 
+template<typename S, typename CB, typename RCB>
+LazyField(S&&, MDLayout, DynamicPrecision, CB&&, RCB&&) -> LazyField<
+    std::conditional_t<
+        std::is_lvalue_reference_v<S>,
+        S,
+        std::remove_cvref_t<S>
+    >
+>;
+
 }  // namespace GridFormat
 
 #endif  // GRIDFORMAT_COMMON_LAZY_FIELD_HPP_
@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Common
+ * \brief Read-only view on the contents of a file via memory mapping.
+ */
+#ifndef GRIDFORMAT_COMMON_MAPPED_FILE_HPP_
+#define GRIDFORMAT_COMMON_MAPPED_FILE_HPP_
+
+#include <span>
+#include <string>
+#include <vector>
+#include <utility>
+#include <fstream>
+#include <cstddef>
+
+#if __has_include(<sys/mman.h>) && __has_include(<sys/stat.h>) && __has_include(<fcntl.h>) && __has_include(<unistd.h>)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define GRIDFORMAT_HAVE_MMAP 1
+#endif
+
+#include <gridformat/common/exceptions.hpp>
+
+namespace GridFormat {
+
+/*!
+ * \ingroup Common
+ * \brief Exposes the contents of a file as a contiguous range of characters.
+ * \details On POSIX systems, the file is mapped into memory (read-only), such that its
+ *          contents are paged in by the operating system upon access. On other systems,
+ *          the entire file is read into memory upon construction.
+ * \note The file must not be modified while it is mapped.
+ */
+class MappedFile {
+ public:
+    explicit MappedFile(const std::string& filename) {
+#if GRIDFORMAT_HAVE_MMAP
+        const int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd == -1)
+            throw IOError("Could not open file '" + filename + "'");
+
+        struct ::stat status;
+        if (::fstat(fd, &status) == -1) {
+            ::close(fd);
+            throw IOError("Could not determine the size of file '" + filename + "'");
+        }
+
+        _size = static_cast<std::size_t>(status.st_size);
+        if (_size > 0) {
+            void* addr = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                ::close(fd);
+                throw IOError("Could not map file '" + filename + "' into memory");
+            }
+            _data = static_cast<const char*>(addr);
+        }
+        ::close(fd);
+#else
+        std::ifstream file{filename, std::ios::binary | std::ios::ate};
+        if (!file)
+            throw IOError("Could not open file '" + filename + "'");
+        _buffer.resize(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+        if (file.gcount() != static_cast<std::streamsize>(_buffer.size()))
+            throw IOError("Could not read file '" + filename + "'");
+        _data = _buffer.data();
+        _size = _buffer.size();
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            _unmap();
+#if !GRIDFORMAT_HAVE_MMAP
+            _buffer = std::move(other._buffer);
+#endif
+            _data = std::exchange(other._data, nullptr);
+            _size = std::exchange(other._size, 0);
+        }
+        return *this;
+    }
+
+    ~MappedFile() {
+        _unmap();
+    }
+
+    //! Return the contents of the file
+    std::span<const char> data() const {
+        return {_data, _size};
+    }
+
+    //! Return the size of the file in bytes
+    std::size_t size() const {
+        return _size;
+    }
+
+ private:
+    void _unmap() {
+#if GRIDFORMAT_HAVE_MMAP
+        if (_data != nullptr)
+            ::munmap(const_cast<char*>(_data), _size);
+#endif
+        _data = nullptr;
+        _size = 0;
+    }
+
+#if !GRIDFORMAT_HAVE_MMAP
+    std::vector<char> _buffer;
+#endif
+    const char* _data = nullptr;
+    std::size_t _size = 0;
+};
+
+}  // namespace GridFormat
+
+#endif  // GRIDFORMAT_COMMON_MAPPED_FILE_HPP_
@@ -8,6 +8,9 @@
 #ifndef GRIDFORMAT_COMMON_RANGE_FIELD_HPP_
 #define GRIDFORMAT_COMMON_RANGE_FIELD_HPP_
 
+#include <span>
+#include <cstddef>
+#include <optional>
 #include <concepts>
 #include <type_traits>
 #include <utility>
@@ -40,6 +43,13 @@ class RangeField : public Field {
         return {Precision<T>{}};
     }
 
+    std::optional<std::span<const std::byte>> _contiguous_bytes() const {
+        if constexpr (is_contiguous_scalar_range<R> && std::same_as<std::remove_cv_t<MDRangeValueType<std::remove_cvref_t<R>>>, T>)
+            return std::as_bytes(std::span{_range});
+        else
+            return std::nullopt;
+    }
+
     Serialization _serialized() const {
         const std::size_t num_bytes = _layout().number_of_entries()*sizeof(T);
         Serialization result(num_bytes);
@@ -48,6 +58,21 @@ class RangeField : public Field {
         return result;
     }
 
+    void _serialize_bytes_into(std::size_t offset, std::span<std::byte> out) const override {
+        if constexpr (is_contiguous_scalar_range<R> && std::same_as<std::remove_cv_t<MDRangeValueType<std::remove_cvref_t<R>>>, T>)
+            return Field::_serialize_bytes_into(offset, out);
+
+        const std::size_t number_of_tuples = Ranges::size(_range);
+        const std::size_t tuple_size_in_bytes = _layout().number_of_entries()*sizeof(T)/number_of_tuples;
+        auto tuple = std::ranges::next(
+            std::ranges::begin(_range),
+            static_cast<std::ranges::range_difference_t<const R>>(offset/tuple_size_in_bytes)
+        );
+        auto it = out.begin();
+        for (std::size_t i = 0; i < out.size()/tuple_size_in_bytes; ++i, ++tuple)
+            _fill(it, *tuple);
+    }
+
     template<std::output_iterator<std::byte> It, std::ranges::range _R>
     void _fill(It& out, _R&& r) const {
         std::ranges::for_each(r, [&] (const auto& entry) { _fill(out, entry); });
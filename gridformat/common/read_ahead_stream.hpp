@@ -0,0 +1,144 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Common
+ * \brief Input file stream that reads ahead in large windows.
+ */
+#ifndef GRIDFORMAT_COMMON_READ_AHEAD_STREAM_HPP_
+#define GRIDFORMAT_COMMON_READ_AHEAD_STREAM_HPP_
+
+#include <ios>
+#include <string>
+#include <vector>
+#include <istream>
+#include <fstream>
+#include <cstddef>
+#include <streambuf>
+#include <algorithm>
+
+#include <gridformat/common/exceptions.hpp>
+
+namespace GridFormat {
+
+/*!
+ * \ingroup Common
+ * \brief Stream buffer that reads a file in large windows.
+ * \details Characters are read from the file in windows of the given read-ahead size, and seeking
+ *          to positions within the current window does not touch the file. Thus, reading several
+ *          small pieces of data in file order only requires few reads from the file, while reads
+ *          that are larger than the window are performed directly into the destination.
+ */
+class ReadAheadFileBuffer : public std::streambuf {
+ public:
+    static constexpr std::size_t default_read_ahead_size = (1 << 20);
+
+    explicit ReadAheadFileBuffer(const std::string& filename,
+                                 std::size_t read_ahead_size = default_read_ahead_size) {
+        _file.pubsetbuf(nullptr, 0);  // reads go directly into the window
+        if (!_file.open(filename, std::ios::in | std::ios::binary))
+            throw IOError("Could not open file '" + filename + "'");
+        _file_size = _file.pubseekoff(0, std::ios::end, std::ios::in);
+        if (_file_size < 0)
+            throw IOError("Could not determine the size of file '" + filename + "'");
+        _window_size = std::clamp(static_cast<off_type>(read_ahead_size), off_type{1}, std::max(_file_size, off_type{1}));
+    }
+
+ protected:
+    int_type underflow() override {
+        if (gptr() < egptr())
+            return traits_type::to_int_type(*gptr());
+        if (!_fill_window_at(_position()))
+            return traits_type::eof();
+        return traits_type::to_int_type(*gptr());
+    }
+
+    std::streamsize xsgetn(char* out, std::streamsize n) override {
+        std::streamsize num_read = _copy_from_window(out, n);
+        if (n - num_read >= _window_size) {
+            const off_type pos = _position();
+            _file.pubseekpos(pos, std::ios::in);
+            const std::streamsize num_direct = std::max(_file.sgetn(out + num_read, n - num_read), std::streamsize{0});
+            _reset_window_at(pos + num_direct);
+            return num_read + num_direct;
+        }
+        while (num_read < n && underflow() != traits_type::eof())
+            num_read += _copy_from_window(out + num_read, n - num_read);
+        return num_read;
+    }
+
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+
+        const off_type base = dir == std::ios_base::beg ? 0
+                            : dir == std::ios_base::cur ? _position()
+                            : _file_size;
+        const off_type target = base + off;
+        if (target < 0 || target > _file_size)
+            return pos_type(off_type(-1));
+
+        if (target >= _window_begin && target <= _window_begin + (egptr() - eback()))
+            setg(eback(), eback() + (target - _window_begin), egptr());
+        else
+            _reset_window_at(target);
+        return pos_type(target);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+ private:
+    off_type _position() const {
+        return _window_begin + (gptr() - eback());
+    }
+
+    std::streamsize _copy_from_window(char* out, std::streamsize n) {
+        const std::streamsize count = std::min(n, static_cast<std::streamsize>(egptr() - gptr()));
+        std::copy_n(gptr(), count, out);
+        setg(eback(), gptr() + count, egptr());
+        return count;
+    }
+
+    void _reset_window_at(off_type pos) {
+        _window_begin = pos;
+        setg(_window.data(), _window.data(), _window.data());
+    }
+
+    bool _fill_window_at(off_type pos) {
+        _window.resize(static_cast<std::size_t>(_window_size));
+        _file.pubseekpos(pos, std::ios::in);
+        const std::streamsize count = _file.sgetn(_window.data(), _window_size);
+        _window_begin = pos;
+        setg(_window.data(), _window.data(), _window.data() + std::max(count, std::streamsize{0}));
+        return count > 0;
+    }
+
+    std::filebuf _file;
+    std::vector<char> _window;
+    off_type _file_size = 0;
+    off_type _window_size = 0;
+    off_type _window_begin = 0;
+};
+
+/*!
+ * \ingroup Common
+ * \brief Input file stream that reads ahead in large windows (see ReadAheadFileBuffer).
+ */
+class ReadAheadFileStream : public std::istream {
+ public:
+    explicit ReadAheadFileStream(const std::string& filename,
+                                 std::size_t read_ahead_size = ReadAheadFileBuffer::default_read_ahead_size)
+    : std::istream{nullptr}
+    , _buffer{filename, read_ahead_size} {
+        rdbuf(&_buffer);
+    }
+
+ private:
+    ReadAheadFileBuffer _buffer;
+};
+
+}  // namespace GridFormat
+
+#endif  // GRIDFORMAT_COMMON_READ_AHEAD_STREAM_HPP_
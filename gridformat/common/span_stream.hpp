@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Common
+ * \brief Input stream reading from a contiguous range of characters in memory.
+ */
+#ifndef GRIDFORMAT_COMMON_SPAN_STREAM_HPP_
+#define GRIDFORMAT_COMMON_SPAN_STREAM_HPP_
+
+#include <span>
+#include <ios>
+#include <istream>
+#include <cstddef>
+#include <streambuf>
+#include <algorithm>
+
+namespace GridFormat {
+
+/*!
+ * \ingroup Common
+ * \brief Read-only, seekable stream buffer over a contiguous range of characters.
+ * \details Allows code that operates on the underlying memory to bypass the stream
+ *          interface (see remaining() and consume()) if the stream buffer of a given
+ *          stream is of this type (see of()).
+ */
+class SpanStreamBuffer : public std::streambuf {
+ public:
+    explicit SpanStreamBuffer(std::span<const char> chars) {
+        // the get area is never written to
+        char* begin = const_cast<char*>(chars.data());
+        setg(begin, begin, begin + chars.size());
+    }
+
+    //! Return the characters from the current position until the end
+    std::span<const char> remaining() const {
+        return {gptr(), static_cast<std::size_t>(egptr() - gptr())};
+    }
+
+    //! Move the current position forward by the given number of characters
+    void consume(std::size_t n) {
+        setg(eback(), gptr() + std::min(n, remaining().size()), egptr());
+    }
+
+    //! Return the stream buffer of the given stream if it is a span stream buffer (nullptr otherwise)
+    static SpanStreamBuffer* of(std::istream& stream) {
+        return dynamic_cast<SpanStreamBuffer*>(stream.rdbuf());
+    }
+
+ protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+
+        const off_type size = egptr() - eback();
+        const off_type base = dir == std::ios_base::beg ? 0
+                            : dir == std::ios_base::cur ? gptr() - eback()
+                            : size;
+        const off_type target = base + off;
+        if (target < 0 || target > size)
+            return pos_type(off_type(-1));
+
+        setg(eback(), eback() + target, egptr());
+        return pos_type(target);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
+/*!
+ * \ingroup Common
+ * \brief Input stream reading from a contiguous range of characters in memory.
+ * \note The characters are not copied, so they must outlive the stream.
+ */
+class SpanInputStream : public std::istream {
+ public:
+    explicit SpanInputStream(std::span<const char> chars)
+    : std::istream{nullptr}
+    , _buffer{chars} {
+        rdbuf(&_buffer);
+    }
+
+    //! Return the underlying stream buffer
+    SpanStreamBuffer& buffer() {
+        return _buffer;
+    }
+
+ private:
+    SpanStreamBuffer _buffer;
+};
+
+}  // namespace GridFormat
+
+#endif  // GRIDFORMAT_COMMON_SPAN_STREAM_HPP_
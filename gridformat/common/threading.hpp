@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Common
+ * \brief Helper functions for distributing work over multiple threads.
+ */
+#ifndef GRIDFORMAT_COMMON_THREADING_HPP_
+#define GRIDFORMAT_COMMON_THREADING_HPP_
+
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <concepts>
+#include <algorithm>
+#include <exception>
+#include <system_error>
+
+namespace GridFormat::Threading {
+
+/*!
+ * \ingroup Common
+ * \brief Return the number of threads supported by the hardware (at least one).
+ */
+inline std::size_t hardware_concurrency() {
+    return std::max(std::size_t{1}, static_cast<std::size_t>(std::thread::hardware_concurrency()));
+}
+
+/*!
+ * \ingroup Common
+ * \brief Return the number of threads to be used for processing the given number of tasks.
+ * \param number_of_tasks The number of (independent) tasks to be processed.
+ * \param num_threads The requested number of threads, where zero means to use all available hardware threads.
+ */
+inline std::size_t number_of_threads_for(std::size_t number_of_tasks, std::size_t num_threads) {
+    const std::size_t requested = num_threads == 0 ? hardware_concurrency() : num_threads;
+    return std::max(std::size_t{1}, std::min(requested, number_of_tasks));
+}
+
+/*!
+ * \ingroup Common
+ * \brief Invoke the given action for all indices in `[0, n)` using up to the given number of threads.
+ * \details The calling thread participates in the work, and indices are distributed dynamically
+ *          among the threads. If only a single thread is to be used, all indices are processed in
+ *          order on the calling thread. Exceptions thrown by the action are rethrown after all
+ *          threads have finished (if several are thrown, the first one is rethrown).
+ * \param n The number of indices to process.
+ * \param num_threads The requested number of threads, where zero means to use all available hardware threads.
+ * \param action The action to be invoked with each index.
+ */
+template<std::invocable<std::size_t> Action>
+void parallel_for(std::size_t n, std::size_t num_threads, const Action& action) {
+    const std::size_t number_of_threads = number_of_threads_for(n, num_threads);
+    if (number_of_threads == 1) {
+        for (std::size_t i = 0; i < n; ++i)
+            action(i);
+        return;
+    }
+
+    std::atomic<std::size_t> next{0};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+    const auto work = [&] () {
+        try {
+            for (std::size_t i = next++; i < n; i = next++)
+                action(i);
+        } catch (...) {
+            std::lock_guard lock{error_mutex};
+            if (!error)
+                error = std::current_exception();
+            next = n;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(number_of_threads - 1);
+    try {
+        for (std::size_t i = 0; i < number_of_threads - 1; ++i)
+            threads.emplace_back(work);
+    } catch (const std::system_error&) {
+        // continue with the threads that could be started
+    }
+    work();
+    std::ranges::for_each(threads, [] (std::thread& t) { t.join(); });
+
+    if (error)
+        std::rethrow_exception(error);
+}
+
+}  // namespace GridFormat::Threading
+
+#endif  // GRIDFORMAT_COMMON_THREADING_HPP_
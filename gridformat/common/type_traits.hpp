@@ -374,6 +374,31 @@ template<typename T>
 inline constexpr bool has_static_size = is_complete<Traits::StaticSize<T>>;
 
 
+#ifndef DOXYGEN
+namespace Detail {
+    template<typename R>
+    constexpr bool is_contiguous_scalar_range() {
+        if constexpr (!std::ranges::contiguous_range<R>)
+            return false;
+        else {
+            using V = std::ranges::range_value_t<R>;
+            if constexpr (is_scalar<V>)
+                return true;
+            else if constexpr (std::ranges::range<V> && has_static_size<V>)
+                return sizeof(V) == static_size<V>*sizeof(std::ranges::range_value_t<V>)
+                    && is_contiguous_scalar_range<V>();
+            else
+                return false;
+        }
+    }
+}  // namespace Detail
+#endif  // DOXYGEN
+
+//! Is true for ranges that store their scalars contiguously in memory (e.g. std::vector<std::array<double, 3>>)
+template<typename R>
+inline constexpr bool is_contiguous_scalar_range = Detail::is_contiguous_scalar_range<std::remove_cvref_t<R>>();
+
+
 #ifndef DOXYGEN
 namespace Detail {
     template<std::ranges::range T> requires(has_static_size<T>)
@@ -58,7 +58,7 @@ struct CompressedBlocks {
         return std::accumulate(
             compressed_block_sizes.begin(),
             compressed_block_sizes.end(),
-            1
+            std::size_t{0}
         );
     }
 };
@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Compression
+ * \brief Compress data block-wise.
+ */
+#ifndef GRIDFORMAT_COMPRESSION_COMPRESS_HPP_
+#define GRIDFORMAT_COMPRESSION_COMPRESS_HPP_
+
+#include <span>
+#include <tuple>
+#include <vector>
+#include <cassert>
+#include <concepts>
+#include <algorithm>
+
+#include <gridformat/common/exceptions.hpp>
+#include <gridformat/common/serialization.hpp>
+#include <gridformat/common/threading.hpp>
+#include <gridformat/common/logging.hpp>
+
+#include <gridformat/compression/concepts.hpp>
+#include <gridformat/compression/common.hpp>
+
+namespace GridFormat::Compression {
+
+/*!
+ * \ingroup Compression
+ * \brief Compress the given data block-wise with the given block compressor.
+ * \details Each block is compressed independently. If more than one thread is requested,
+ *          the blocks are distributed over the threads, each of which compresses its blocks into
+ *          a dedicated region of the output buffer. Afterwards, the compressed blocks are moved
+ *          together such that the result is identical to the one obtained with serial compression.
+ * \param in The data to be compressed
+ * \param block_compressor The compressor to be used for individual blocks
+ * \param block_size The (uncompressed) size of the blocks
+ * \param num_threads The number of threads to use (zero means to use all available hardware threads)
+ * \return A tuple containing the compressed block sizes and the compressed data.
+ */
+template<std::integral HeaderType, Concepts::BlockCompressor BlockCompressor>
+auto compress(std::span<const typename BlockCompressor::ByteType> in,
+              const BlockCompressor& block_compressor,
+              std::size_t block_size,
+              std::size_t num_threads = 1) {
+    using Byte = typename BlockCompressor::ByteType;
+
+    const HeaderType size_in_bytes = static_cast<HeaderType>(in.size());
+    const Blocks<HeaderType> blocks{size_in_bytes, static_cast<HeaderType>(block_size)};
+    const std::size_t block_bound = block_compressor.compressed_size_bound(block_size);
+    const auto in_block = [&] (std::size_t i) {
+        const std::size_t offset = i*block_size;
+        return in.subspan(offset, std::min(block_size, in.size() - offset));
+    };
+
+    Serialization compressed{block_bound*blocks.number_of_blocks};
+    std::vector<HeaderType> compressed_block_sizes(blocks.number_of_blocks);
+    auto out = compressed.template as_span_of<Byte>();
+
+    std::size_t cur_out = 0;
+    const std::size_t number_of_threads = Threading::number_of_threads_for(blocks.number_of_blocks, num_threads);
+    if (number_of_threads == 1) {
+        for (std::size_t i = 0; i < blocks.number_of_blocks; ++i) {
+            assert(cur_out + block_bound <= out.size());
+            const std::size_t out_len = block_compressor(in_block(i), out.subspan(cur_out, block_bound));
+            compressed_block_sizes[i] = static_cast<HeaderType>(out_len);
+            cur_out += out_len;
+        }
+    } else {
+        Threading::parallel_for(blocks.number_of_blocks, number_of_threads, [&] (std::size_t i) {
+            compressed_block_sizes[i] = static_cast<HeaderType>(
+                block_compressor(in_block(i), out.subspan(i*block_bound, block_bound))
+            );
+        });
+        for (std::size_t i = 0; i < blocks.number_of_blocks; ++i) {
+            assert(cur_out <= i*block_bound);
+            std::copy_n(out.data() + i*block_bound, compressed_block_sizes[i], out.data() + cur_out);
+            cur_out += compressed_block_sizes[i];
+        }
+    }
+
+    if (cur_out > out.size())
+        throw InvalidState(as_error("Unexpected number of compressed bytes"));
+
+    return std::make_tuple(
+        CompressedBlocks<HeaderType>{blocks, std::move(compressed_block_sizes)},
+        std::move(compressed)
+    );
+}
+
+/*!
+ * \ingroup Compression
+ * \brief Compress the given data block-wise and pass the compressed blocks to the given callback.
+ * \details In contrast to compress(), the compressed data is not gathered in a single buffer, but
+ *          each compressed block is handed over to the callback (in order) as soon as it is ready.
+ *          Thus, only a few blocks are held in memory at any time. If more than one thread is
+ *          requested, batches of blocks are compressed concurrently before they are passed on.
+ * \param in The data to be compressed
+ * \param block_compressor The compressor to be used for individual blocks
+ * \param block_size The (uncompressed) size of the blocks
+ * \param num_threads The number of threads to use (zero means to use all available hardware threads)
+ * \param callback Callback that is invoked with each compressed block
+ * \return The compressed block sizes.
+ */
+template<std::integral HeaderType, Concepts::BlockCompressor BlockCompressor, typename BlockCallback>
+    requires(std::invocable<BlockCallback&, std::span<const typename BlockCompressor::ByteType>>)
+CompressedBlocks<HeaderType> compress_blockwise(std::span<const typename BlockCompressor::ByteType> in,
+                                                const BlockCompressor& block_compressor,
+                                                std::size_t block_size,
+                                                std::size_t num_threads,
+                                                BlockCallback&& callback) {
+    using Byte = typename BlockCompressor::ByteType;
+    static constexpr std::size_t blocks_per_thread = 4;
+
+    const HeaderType size_in_bytes = static_cast<HeaderType>(in.size());
+    const Blocks<HeaderType> blocks{size_in_bytes, static_cast<HeaderType>(block_size)};
+    const std::size_t block_bound = block_compressor.compressed_size_bound(block_size);
+    const std::size_t number_of_threads = Threading::number_of_threads_for(blocks.number_of_blocks, num_threads);
+    const std::size_t batch_size = number_of_threads == 1 ? 1 : number_of_threads*blocks_per_thread;
+    const auto in_block = [&] (std::size_t i) {
+        const std::size_t offset = i*block_size;
+        return in.subspan(offset, std::min(block_size, in.size() - offset));
+    };
+
+    std::vector<Byte> buffer(block_bound*std::min<std::size_t>(batch_size, blocks.number_of_blocks));
+    std::vector<HeaderType> compressed_block_sizes(blocks.number_of_blocks);
+    for (std::size_t batch_begin = 0; batch_begin < blocks.number_of_blocks; batch_begin += batch_size) {
+        const std::size_t num_batch_blocks = std::min(batch_size, blocks.number_of_blocks - batch_begin);
+        Threading::parallel_for(num_batch_blocks, number_of_threads, [&] (std::size_t i) {
+            compressed_block_sizes[batch_begin + i] = static_cast<HeaderType>(
+                block_compressor(
+                    in_block(batch_begin + i),
+                    std::span{buffer}.subspan(i*block_bound, block_bound)
+                )
+            );
+        });
+        for (std::size_t i = 0; i < num_batch_blocks; ++i)
+            callback(std::span<const Byte>{
+                buffer.data() + i*block_bound,
+                static_cast<std::size_t>(compressed_block_sizes[batch_begin + i])
+            });
+    }
+
+    return CompressedBlocks<HeaderType>{blocks, std::move(compressed_block_sizes)};
+}
+
+}  // end namespace GridFormat::Compression
+
+#endif  // GRIDFORMAT_COMPRESSION_COMPRESS_HPP_
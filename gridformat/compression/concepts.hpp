@@ -10,6 +10,7 @@
 
 #include <span>
 #include <ranges>
+#include <cstddef>
 #include <concepts>
 #include <type_traits>
 
@@ -32,6 +33,10 @@ namespace CompressionDetail {
     template<typename T>
     concept ValidCompressionResult = IsCompressedBlocks<T>::value;
 
+    struct BlockSink {
+        void operator()(std::span<const std::byte>) const {}
+    };
+
 }  // namespace CompressionDetail
 #endif  // DOXYGEN
 
@@ -41,6 +46,13 @@ concept Compressor = requires(const T& t, Serialization& s) {
     { t.compress(s) } -> CompressionDetail::ValidCompressionResult;
 };
 
+//! Concept for compressors that can pass the compressed blocks one-by-one to a callback
+template<typename T>
+concept BlockwiseCompressor = Compressor<T> and requires(const T& t, std::span<const std::byte> in) {
+    { t.compress_blockwise(in, CompressionDetail::BlockSink{}) } -> CompressionDetail::ValidCompressionResult;
+    { t.options().block_size } -> std::convertible_to<std::size_t>;
+};
+
 //! Concept that decompressors must fulfill
 template<typename T>
 concept Decompressor = requires(const T& t,
@@ -49,6 +61,18 @@ concept Decompressor = requires(const T& t,
     { t.decompress(s, b) };
 };
 
+//! Concept that block compressors must fulfill (invocation returns the compressed size)
+template<typename T>
+concept BlockCompressor
+    = requires { typename T::ByteType; }
+    and requires(const T& t,
+                 std::size_t size,
+                 std::span<const typename T::ByteType> in,
+                 std::span<typename T::ByteType> out) {
+        { t.compressed_size_bound(size) } -> std::convertible_to<std::size_t>;
+        { t(in, out) } -> std::convertible_to<std::size_t>;
+    };
+
 //! Concept that block decompressors must fulfill
 template<typename T>
 concept BlockDecompressor
@@ -8,10 +8,17 @@
 #ifndef GRIDFORMAT_COMPRESSION_DECOMPRESS_HPP_
 #define GRIDFORMAT_COMPRESSION_DECOMPRESS_HPP_
 
+#include <span>
 #include <string>
+#include <vector>
+#include <numeric>
+#include <utility>
+#include <cstddef>
+#include <functional>
 
 #include <gridformat/common/exceptions.hpp>
 #include <gridformat/common/serialization.hpp>
+#include <gridformat/common/threading.hpp>
 
 #include <gridformat/compression/concepts.hpp>
 #include <gridformat/compression/common.hpp>
@@ -20,39 +27,95 @@ namespace GridFormat::Compression {
 
 /*!
  * \ingroup Compression
- * \brief Decompress compressed data.
+ * \brief Return the number of bytes of the decompressed data.
+ */
+template<std::integral HeaderType>
+std::size_t decompressed_size(const CompressedBlocks<HeaderType>& blocks) {
+    if (blocks.number_of_blocks == 0)
+        return 0;
+    const std::size_t last_block_size = blocks.residual_block_size > 0 ? blocks.residual_block_size : blocks.block_size;
+    return blocks.block_size*(blocks.number_of_blocks - 1) + last_block_size;
+}
+
+/*!
+ * \ingroup Compression
+ * \brief Decompress compressed data directly into the given output buffer.
+ * \details Since the block boundaries are known from the compressed block sizes, the blocks
+ *          can be decompressed concurrently directly into the output buffer. Multiple threads
+ *          are only used if each one has at least `min_blocks_per_thread` blocks to process.
+ * \param in The compressed data
+ * \param blocks The block sizes of the compressed data
+ * \param block_decompressor The decompressor to be used for individual blocks
+ * \param out The output buffer (its size must match the number of decompressed bytes)
+ * \param num_threads The number of threads to use (zero means to use all available hardware threads)
  */
 template<std::integral HeaderType, Concepts::BlockDecompressor Decompressor>
-void decompress(Serialization& in,
-                const CompressedBlocks<HeaderType>& blocks,
-                const Decompressor& block_decompressor) {
+void decompress_into(std::span<const std::byte> in,
+                     const CompressedBlocks<HeaderType>& blocks,
+                     const Decompressor& block_decompressor,
+                     std::span<std::byte> out,
+                     std::size_t num_threads = 1) {
     using Byte = typename Decompressor::ByteType;
+    static constexpr std::size_t min_blocks_per_thread = 4;
 
-    const auto last_block_size = blocks.residual_block_size > 0 ? blocks.residual_block_size : blocks.block_size;
-    const auto out_size = blocks.block_size*(blocks.number_of_blocks-1) + last_block_size;
-
-    std::size_t in_offset = 0;
-    std::size_t out_offset = 0;
-    Serialization out{out_size};
+    const auto out_size = decompressed_size(blocks);
+    if (out.size() != out_size)
+        throw SizeError(
+            "Output buffer size does not match the number of decompressed bytes: "
+            + std::to_string(out.size()) + " vs. " + std::to_string(out_size)
+        );
+    if (blocks.number_of_blocks == 0)
+        return;
 
-    const auto* in_data = in.template as_span_of<const Byte>().data();
-    auto* out_data = out.template as_span_of<Byte>().data();
-    std::ranges::for_each(std::views::iota(HeaderType{0}, blocks.number_of_blocks), [&] (HeaderType i) {
-        const auto out_block_size = (i == blocks.number_of_blocks - 1) ? last_block_size : blocks.block_size;
+    std::vector<std::size_t> in_offsets(blocks.number_of_blocks + 1, 0);
+    std::inclusive_scan(
+        blocks.compressed_block_sizes.begin(),
+        blocks.compressed_block_sizes.end(),
+        in_offsets.begin() + 1,
+        std::plus{},
+        std::size_t{0}
+    );
+    if (in_offsets.back() > in.size())
+        throw SizeError(
+            "Compressed block sizes exceed the number of given bytes: "
+            + std::to_string(in_offsets.back()) + " vs. " + std::to_string(in.size())
+        );
 
+    const auto last_block_size = blocks.residual_block_size > 0 ? blocks.residual_block_size : blocks.block_size;
+    const auto* in_data = reinterpret_cast<const Byte*>(in.data());
+    auto* out_data = reinterpret_cast<Byte*>(out.data());
+    const auto decompress_block = [&] (std::size_t i) {
+        const std::size_t out_block_size = (i == blocks.number_of_blocks - 1) ? last_block_size : blocks.block_size;
         block_decompressor(
-            std::span{in_data + in_offset, blocks.compressed_block_sizes[i]},
-            std::span{out_data + out_offset, out_block_size}
+            std::span{in_data + in_offsets[i], blocks.compressed_block_sizes[i]},
+            std::span{out_data + i*blocks.block_size, out_block_size}
         );
+    };
 
-        in_offset += blocks.compressed_block_sizes[i];
-        out_offset += out_block_size;
-    });
-    if (out_offset != out.size())
-        throw SizeError(
-            "Unexpected number of bytes written: " + std::to_string(out_offset) + " vs. " + std::to_string(out.size())
-        );
-    in = out;
+    const std::size_t max_number_of_threads = blocks.number_of_blocks/min_blocks_per_thread;
+    Threading::parallel_for(
+        blocks.number_of_blocks,
+        Threading::number_of_threads_for(max_number_of_threads, num_threads),
+        decompress_block
+    );
+}
+
+/*!
+ * \ingroup Compression
+ * \brief Decompress compressed data.
+ * \param in The compressed data (is overwritten with the decompressed data)
+ * \param blocks The block sizes of the compressed data
+ * \param block_decompressor The decompressor to be used for individual blocks
+ * \param num_threads The number of threads to use (zero means to use all available hardware threads)
+ */
+template<std::integral HeaderType, Concepts::BlockDecompressor Decompressor>
+void decompress(Serialization& in,
+                const CompressedBlocks<HeaderType>& blocks,
+                const Decompressor& block_decompressor,
+                std::size_t num_threads = 1) {
+    Serialization out{decompressed_size(blocks)};
+    decompress_into(std::as_const(in).as_span(), blocks, block_decompressor, out.as_span(), num_threads);
+    in = std::move(out);
 }
 
 }  // end namespace GridFormat::Compression
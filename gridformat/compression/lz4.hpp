@@ -10,6 +10,8 @@
 #define GRIDFORMAT_COMPRESSION_LZ4_HPP_
 #if GRIDFORMAT_HAVE_LZ4
 
+#include <span>
+#include <cstddef>
 #include <concepts>
 #include <utility>
 #include <vector>
@@ -24,6 +26,7 @@
 #include <gridformat/common/logging.hpp>
 
 #include <gridformat/compression/common.hpp>
+#include <gridformat/compression/compress.hpp>
 #include <gridformat/compression/decompress.hpp>
 
 namespace GridFormat::Compression {
@@ -35,6 +38,7 @@ namespace GridFormat::Compression {
 struct LZ4Options {
     std::size_t block_size = default_block_size;
     int acceleration_factor = 1;  // LZ4_ACCELERATION_DEFAULT
+    std::size_t num_threads = 1;  //!< Number of threads used to (de-)compress blocks concurrently (0 = all available)
 };
 
 //! Compressor using the lz4 compression library
@@ -42,6 +46,29 @@ class LZ4 {
     using LZ4Byte = char;
     static_assert(sizeof(typename Serialization::Byte) == sizeof(LZ4Byte));
 
+    struct BlockCompressor {
+        using ByteType = LZ4Byte;
+
+        int acceleration_factor;
+
+        std::size_t compressed_size_bound(std::size_t block_size) const {
+            return LZ4_COMPRESSBOUND(block_size);
+        }
+
+        std::size_t operator()(std::span<const ByteType> in, std::span<ByteType> out) const {
+            const auto compressed_length = LZ4_compress_fast(
+                in.data(),                      // const char* src
+                out.data(),                     // char* dst
+                static_cast<int>(in.size()),    // src_size
+                static_cast<int>(out.size()),   // dst_capacity
+                acceleration_factor             // lz4 acc factor
+            );
+            if (compressed_length == 0)
+                throw InvalidState(as_error("Error upon compression with LZ4"));
+            return static_cast<std::size_t>(compressed_length);
+        }
+    };
+
     struct BlockDecompressor {
         using ByteType = LZ4Byte;
 
@@ -67,10 +94,7 @@ class LZ4 {
     template<std::integral HeaderType = std::size_t>
     CompressedBlocks<HeaderType> compress(Serialization& in) const {
         static_assert(sizeof(typename Serialization::Byte) == sizeof(LZ4Byte));
-        if (std::numeric_limits<HeaderType>::max() < in.size())
-            throw TypeError("Chosen HeaderType is too small for given number of bytes");
-        if (std::numeric_limits<HeaderType>::max() < _opts.block_size)
-            throw TypeError("Chosen HeaderType is too small for given block size");
+        _check_header_type<HeaderType>(in.size());
 
         auto [blocks, out] = _compress<HeaderType>(in.template as_span_of<const LZ4Byte>());
         in = std::move(out);
@@ -78,9 +102,43 @@ class LZ4 {
         return blocks;
     }
 
+    //! Compress the given data (leaving it untouched) and return the block sizes and the compressed data
+    template<std::integral HeaderType = std::size_t>
+    std::tuple<CompressedBlocks<HeaderType>, Serialization> compress(std::span<const std::byte> in) const {
+        _check_header_type<HeaderType>(in.size());
+        auto [blocks, out] = _compress<HeaderType>(std::span{reinterpret_cast<const LZ4Byte*>(in.data()), in.size()});
+        out.resize(blocks.compressed_size());
+        return {std::move(blocks), std::move(out)};
+    }
+
     template<typename HeaderType>
-    static void decompress(Serialization& in, const CompressedBlocks<HeaderType>& blocks) {
-        Compression::decompress(in, blocks, BlockDecompressor{});
+    void decompress(Serialization& in, const CompressedBlocks<HeaderType>& blocks) const {
+        Compression::decompress(in, blocks, BlockDecompressor{}, _opts.num_threads);
+    }
+
+    //! Decompress the given data directly into the given output buffer
+    template<std::integral HeaderType>
+    void decompress_into(std::span<const std::byte> in,
+                         const CompressedBlocks<HeaderType>& blocks,
+                         std::span<std::byte> out) const {
+        Compression::decompress_into(in, blocks, BlockDecompressor{}, out, _opts.num_threads);
+    }
+
+    //! Compress the given data block-wise, passing each compressed block to the given callback
+    template<std::integral HeaderType = std::size_t, std::invocable<std::span<const std::byte>> BlockCallback>
+    CompressedBlocks<HeaderType> compress_blockwise(std::span<const std::byte> in, BlockCallback&& callback) const {
+        _check_header_type<HeaderType>(in.size());
+        return Compression::compress_blockwise<HeaderType>(
+            std::span{reinterpret_cast<const LZ4Byte*>(in.data()), in.size()},
+            BlockCompressor{_opts.acceleration_factor},
+            _opts.block_size,
+            _opts.num_threads,
+            [&] (std::span<const LZ4Byte> block) { callback(std::as_bytes(block)); }
+        );
+    }
+
+    const Options& options() const {
+        return _opts;
     }
 
     static LZ4 with(Options opts) {
@@ -89,51 +147,20 @@ class LZ4 {
 
  private:
     template<std::integral HeaderType>
-    auto _compress(std::span<const LZ4Byte> in) const {
-        HeaderType block_size = static_cast<HeaderType>(_opts.block_size);
-        HeaderType size_in_bytes = static_cast<HeaderType>(in.size());
-        Blocks<HeaderType> blocks{size_in_bytes, block_size};
-
-        Serialization compressed;
-        std::vector<LZ4Byte> block_buffer;
-        std::vector<HeaderType> compressed_block_sizes;
-        block_buffer.reserve(LZ4_COMPRESSBOUND(_opts.block_size));
-        compressed_block_sizes.reserve(blocks.number_of_blocks);
-        compressed.resize(block_buffer.capacity()*blocks.number_of_blocks);
-
-        HeaderType cur_in = 0;
-        HeaderType cur_out = 0;
-        auto out = compressed.template as_span_of<LZ4Byte>();
-        while (cur_in < size_in_bytes) {
-            using std::min;
-            const HeaderType cur_block_size = min(block_size, size_in_bytes - cur_in);
-            assert(cur_in + cur_block_size <= size_in_bytes);
-
-            const auto compressed_length = LZ4_compress_fast(
-                in.data() + cur_in,        // const char* src
-                block_buffer.data(),       // char* dst
-                cur_block_size,            // src_size
-                block_buffer.capacity(),   // dst_capacity
-                _opts.acceleration_factor  // lz4 acc factor
-            );
-            if (compressed_length == 0)
-                throw InvalidState(as_error("Error upon compression with LZ4"));
-
-            assert(cur_out + compressed_length <= out.size());
-            std::copy_n(block_buffer.data(),
-                        compressed_length,
-                        out.data() + cur_out);
-            cur_in += cur_block_size;
-            cur_out += compressed_length;
-            compressed_block_sizes.push_back(static_cast<HeaderType>(compressed_length));
-        }
-
-        if (cur_in != size_in_bytes)
-            throw InvalidState(as_error("(LZ4Compressor) unexpected number of bytes processed"));
+    void _check_header_type(std::size_t size_in_bytes) const {
+        if (std::numeric_limits<HeaderType>::max() < size_in_bytes)
+            throw TypeError("Chosen HeaderType is too small for given number of bytes");
+        if (std::numeric_limits<HeaderType>::max() < _opts.block_size)
+            throw TypeError("Chosen HeaderType is too small for given block size");
+    }
 
-        return std::make_tuple(
-            CompressedBlocks<HeaderType>{blocks, std::move(compressed_block_sizes)},
-            compressed
+    template<std::integral HeaderType>
+    auto _compress(std::span<const LZ4Byte> in) const {
+        return Compression::compress<HeaderType>(
+            in,
+            BlockCompressor{_opts.acceleration_factor},
+            _opts.block_size,
+            _opts.num_threads
         );
     }
 
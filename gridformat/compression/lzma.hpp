@@ -10,6 +10,8 @@
 #define GRIDFORMAT_COMPRESSION_LZMA_HPP_
 #if GRIDFORMAT_HAVE_LZMA
 
+#include <span>
+#include <cstddef>
 #include <concepts>
 #include <utility>
 #include <vector>
@@ -25,6 +27,7 @@
 #include <gridformat/common/logging.hpp>
 
 #include <gridformat/compression/common.hpp>
+#include <gridformat/compression/compress.hpp>
 #include <gridformat/compression/decompress.hpp>
 
 namespace GridFormat::Compression {
@@ -36,6 +39,7 @@ namespace GridFormat::Compression {
 struct LZMAOptions {
     std::size_t block_size = default_block_size;
     std::uint32_t compression_level = LZMA_PRESET_DEFAULT;
+    std::size_t num_threads = 1;  //!< Number of threads used to (de-)compress blocks concurrently (0 = all available)
 };
 
 //! Compressor using the lzma library
@@ -43,6 +47,28 @@ class LZMA {
     using LZMAByte = std::uint8_t;
     static_assert(sizeof(typename Serialization::Byte) == sizeof(LZMAByte));
 
+    struct BlockCompressor {
+        using ByteType = LZMAByte;
+
+        std::uint32_t compression_level;
+
+        std::size_t compressed_size_bound(std::size_t block_size) const {
+            return lzma_stream_buffer_bound(block_size);
+        }
+
+        std::size_t operator()(std::span<const ByteType> in, std::span<ByteType> out) const {
+            std::size_t out_pos = 0;
+            const auto lzma_ret = lzma_easy_buffer_encode(
+                compression_level, LZMA_CHECK_CRC32, nullptr,
+                in.data(), in.size(),
+                out.data(), &out_pos, out.size()
+            );
+            if (lzma_ret != LZMA_OK)
+                throw InvalidState(as_error("(LZMACompressor) Error upon compression"));
+            return out_pos;
+        }
+    };
+
     struct BlockDecompressor {
         using ByteType = LZMAByte;
 
@@ -70,10 +96,7 @@ class LZMA {
     template<std::integral HeaderType = std::size_t>
     CompressedBlocks<HeaderType> compress(Serialization& in) const {
         static_assert(sizeof(typename Serialization::Byte) == sizeof(LZMAByte));
-        if (std::numeric_limits<HeaderType>::max() < in.size())
-            throw TypeError("Chosen HeaderType is too small for given number of bytes");
-        if (std::numeric_limits<HeaderType>::max() < _opts.block_size)
-            throw TypeError("Chosen HeaderType is too small for given block size");
+        _check_header_type<HeaderType>(in.size());
 
         auto [blocks, out] = _compress<HeaderType>(in.template as_span_of<const LZMAByte>());
         in = std::move(out);
@@ -81,9 +104,43 @@ class LZMA {
         return blocks;
     }
 
+    //! Compress the given data (leaving it untouched) and return the block sizes and the compressed data
+    template<std::integral HeaderType = std::size_t>
+    std::tuple<CompressedBlocks<HeaderType>, Serialization> compress(std::span<const std::byte> in) const {
+        _check_header_type<HeaderType>(in.size());
+        auto [blocks, out] = _compress<HeaderType>(std::span{reinterpret_cast<const LZMAByte*>(in.data()), in.size()});
+        out.resize(blocks.compressed_size());
+        return {std::move(blocks), std::move(out)};
+    }
+
+    template<std::integral HeaderType>
+    void decompress(Serialization& in, const CompressedBlocks<HeaderType>& blocks) const {
+        Compression::decompress(in, blocks, BlockDecompressor{}, _opts.num_threads);
+    }
+
+    //! Decompress the given data directly into the given output buffer
     template<std::integral HeaderType>
-    static void decompress(Serialization& in, const CompressedBlocks<HeaderType>& blocks) {
-        Compression::decompress(in, blocks, BlockDecompressor{});
+    void decompress_into(std::span<const std::byte> in,
+                         const CompressedBlocks<HeaderType>& blocks,
+                         std::span<std::byte> out) const {
+        Compression::decompress_into(in, blocks, BlockDecompressor{}, out, _opts.num_threads);
+    }
+
+    //! Compress the given data block-wise, passing each compressed block to the given callback
+    template<std::integral HeaderType = std::size_t, std::invocable<std::span<const std::byte>> BlockCallback>
+    CompressedBlocks<HeaderType> compress_blockwise(std::span<const std::byte> in, BlockCallback&& callback) const {
+        _check_header_type<HeaderType>(in.size());
+        return Compression::compress_blockwise<HeaderType>(
+            std::span{reinterpret_cast<const LZMAByte*>(in.data()), in.size()},
+            BlockCompressor{_opts.compression_level},
+            _opts.block_size,
+            _opts.num_threads,
+            [&] (std::span<const LZMAByte> block) { callback(std::as_bytes(block)); }
+        );
+    }
+
+    const Options& options() const {
+        return _opts;
     }
 
     static LZMA with(Options opts) {
@@ -92,50 +149,20 @@ class LZMA {
 
  private:
     template<std::integral HeaderType>
-    auto _compress(std::span<const LZMAByte> in) const {
-        HeaderType block_size = static_cast<HeaderType>(_opts.block_size);
-        HeaderType size_in_bytes = static_cast<HeaderType>(in.size());
-        Blocks<HeaderType> blocks{size_in_bytes, block_size};
-
-        Serialization compressed;
-        std::vector<LZMAByte> block_buffer;
-        std::vector<HeaderType> compressed_block_sizes;
-        block_buffer.reserve(lzma_stream_buffer_bound(_opts.block_size));
-        compressed_block_sizes.reserve(blocks.number_of_blocks);
-        compressed.resize(block_buffer.capacity()*blocks.number_of_blocks);
-
-        HeaderType cur_in = 0;
-        HeaderType cur_out = 0;
-        auto out = compressed.template as_span_of<LZMAByte>();
-        while (cur_in < size_in_bytes) {
-            using std::min;
-            const HeaderType cur_block_size = min(block_size, size_in_bytes - cur_in);
-            assert(cur_in + cur_block_size <= size_in_bytes);
-
-            std::size_t out_pos = 0;
-            const auto lzma_ret = lzma_easy_buffer_encode(
-                _opts.compression_level, LZMA_CHECK_CRC32, nullptr,
-                in.data() + cur_in, cur_block_size,
-                block_buffer.data(), &out_pos, block_buffer.capacity()
-            );
-            if (lzma_ret != LZMA_OK)
-                throw InvalidState(as_error("(LZMACompressor) Error upon compression"));
-
-            assert(cur_out + out_pos <= out.size());
-            std::copy_n(block_buffer.data(),
-                        out_pos,
-                        out.data() + cur_out);
-            cur_in += cur_block_size;
-            cur_out += out_pos;
-            compressed_block_sizes.push_back(static_cast<HeaderType>(out_pos));
-        }
-
-        if (cur_in != size_in_bytes)
-            throw InvalidState(as_error("(LZMACompressor) unexpected number of bytes processed"));
+    void _check_header_type(std::size_t size_in_bytes) const {
+        if (std::numeric_limits<HeaderType>::max() < size_in_bytes)
+            throw TypeError("Chosen HeaderType is too small for given number of bytes");
+        if (std::numeric_limits<HeaderType>::max() < _opts.block_size)
+            throw TypeError("Chosen HeaderType is too small for given block size");
+    }
 
-        return std::make_tuple(
-            CompressedBlocks<HeaderType>{blocks, std::move(compressed_block_sizes)},
-            compressed
+    template<std::integral HeaderType>
+    auto _compress(std::span<const LZMAByte> in) const {
+        return Compression::compress<HeaderType>(
+            in,
+            BlockCompressor{_opts.compression_level},
+            _opts.block_size,
+            _opts.num_threads
         );
     }
 
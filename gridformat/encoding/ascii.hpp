@@ -15,15 +15,27 @@
 #include <optional>
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <span>
 #include <sstream>
+#include <istream>
+#include <locale>
+#include <charconv>
+#include <numeric>
+#include <ranges>
+#include <utility>
+#include <vector>
 
 #if __has_include(<format>)
 #include <format>
 #endif
 
+#include <gridformat/common/concepts.hpp>
+#include <gridformat/common/exceptions.hpp>
 #include <gridformat/common/output_stream.hpp>
 #include <gridformat/common/reserved_string.hpp>
+#include <gridformat/common/threading.hpp>
+#include <gridformat/common/span_stream.hpp>
 
 #ifndef DOXYGEN
 namespace GridFormat::Encoding::Detail {
@@ -49,67 +61,90 @@ struct AsciiFormatOptions {
     ReservedString<30> line_prefix{""};
     std::size_t entries_per_line = std::numeric_limits<std::size_t>::max();
     std::size_t num_cached_lines = 100; //!< Number of line cached between flushing the buffer
+    std::size_t num_threads = 1;        //!< Number of threads used to format chunks of `num_cached_lines` lines (0 = all available)
 
     friend bool operator==(const AsciiFormatOptions& a, const AsciiFormatOptions& b) {
         return a.delimiter == b.delimiter
             && a.line_prefix == b.line_prefix
             && a.entries_per_line == b.entries_per_line
-            && a.num_cached_lines == b.num_cached_lines;
+            && a.num_cached_lines == b.num_cached_lines
+            && a.num_threads == b.num_threads;
     }
 };
 
-//! Wrapper around a given stream to write formatted ascii output
+/*!
+ * \brief Wrapper around a given stream to write formatted ascii output.
+ * \details Values are formatted with `std::to_chars` into a preallocated buffer, where floating-point
+ *          values are written in the shortest representation that parses back to the same value.
+ *          If multiple threads are requested, chunks of lines are formatted concurrently and written in order.
+ */
 template<typename OStream>
 class AsciiOutputStream : public OutputStreamWrapperBase<OStream> {
+    static constexpr std::size_t buffer_size = (1 << 16);
+    static constexpr std::size_t max_value_chars = 32;
+
     class Buffer {
      public:
-        Buffer(std::streamsize precision)
-        : _precision{precision} {
-            _init_stream_buf();
+        explicit Buffer(std::size_t capacity)
+        : _chars(capacity, '\0')
+        {}
+
+        std::size_t free_space() const {
+            return _chars.size() - _size;
         }
 
-        template<typename V, typename D>
-        void push(V&& value, D&& delimiter) {
-#if __cpp_lib_format
-            if constexpr (std::floating_point<std::remove_cvref_t<V>>)
-                std::format_to(std::back_inserter(_string_buf),
-                    "{:.{}g}{}", std::forward<V>(value), _precision, std::forward<D>(delimiter)
-                );
-            else
-                std::format_to(std::back_inserter(_string_buf),
-                    "{}{}", std::forward<V>(value), std::forward<D>(delimiter)
-                );
-#else
-            _stream_buf << std::forward<V>(value) << std::forward<D>(delimiter);
-#endif
+        void append(std::string_view chars) {
+            _grow_for(chars.size());
+            std::ranges::copy(chars, _chars.data() + _size);
+            _size += chars.size();
         }
 
-        void prepare_readout() {
-#if !__cpp_lib_format
-            // move internal string buffer out of the stream
-            // (see https://stackoverflow.com/a/66662433)
-            _string_buf = std::move(_stream_buf).str();
-            _init_stream_buf(); // reinitialize
-#endif
+        template<typename V>
+        void append_value(V value) {
+            _grow_for(max_value_chars);
+            char* end = _to_chars(_chars.data() + _size, _chars.data() + _chars.size(), value);
+            _size = static_cast<std::size_t>(end - _chars.data());
         }
 
         auto data() const {
-            return std::span{_string_buf.data(), _string_buf.size()};
+            return std::span{_chars.data(), _size};
         }
 
         void clear() {
-            _string_buf.clear();
+            _size = 0;
         }
 
      private:
-        void _init_stream_buf() {
-            _stream_buf = {};
-            _stream_buf.precision(_precision);
+        void _grow_for(std::size_t num_chars) {
+            if (free_space() < num_chars)
+                _chars.resize(std::max(2*_chars.size(), _size + num_chars));
         }
 
-        std::streamsize _precision;
-        std::string _string_buf;
-        std::ostringstream _stream_buf;
+        template<typename V>
+        static char* _to_chars(char* first, char* last, V value) {
+#if !__cpp_lib_to_chars
+            // floating-point support for std::to_chars is missing in some standard libraries
+            if constexpr (std::floating_point<V>) {
+#if __cpp_lib_format
+                return std::format_to_n(first, last - first, "{}", value).out;
+#else
+                std::ostringstream s;
+                s.imbue(std::locale::classic());
+                s.precision(std::numeric_limits<V>::max_digits10);
+                s << value;
+                const auto str = s.str();
+                return std::ranges::copy(str, first).out;
+#endif
+            } else {
+                return std::to_chars(first, last, value).ptr;
+            }
+#else
+            return std::to_chars(first, last, value).ptr;
+#endif
+        }
+
+        std::string _chars;
+        std::size_t _size = 0;
     };
 
  public:
@@ -120,40 +155,280 @@ class AsciiOutputStream : public OutputStreamWrapperBase<OStream> {
 
     template<typename T, std::size_t size>
     void write(std::span<T, size> data) {
-        std::size_t count_entries = 0;
-        std::size_t count_buffer_lines = 0;
-
-        using PrintType = typename Encoding::Detail::AsciiPrintType<T>::type;
-        Buffer buffer(std::numeric_limits<PrintType>::digits10);
-        while (count_entries < data.size()) {
-            buffer.push(count_entries > 0 ? "\n" : "", _opts.line_prefix);
-
-            using std::min;
-            const auto num_entries = min(_opts.entries_per_line, data.size() - count_entries);
-            for (const auto& value : data.subspan(count_entries, num_entries))
-                buffer.push(static_cast<PrintType>(value), _opts.delimiter);
-
-            // update counters
-            count_entries += num_entries;
-            ++count_buffer_lines;
-
-            // flush and reset buffer
-            if (count_buffer_lines >= _opts.num_cached_lines) {
-                buffer.prepare_readout();
-                this->_write_raw(buffer.data());
-                buffer.clear();
-                count_buffer_lines = 0;
+        using PrintType = typename Encoding::Detail::AsciiPrintType<std::remove_cv_t<T>>::type;
+        const std::size_t entries_per_line = std::max(_opts.entries_per_line, std::size_t{1});
+        const std::size_t lines_per_chunk = std::max(_opts.num_cached_lines, std::size_t{1});
+        const std::size_t num_lines = data.size()/entries_per_line + (data.size()%entries_per_line ? 1 : 0);
+        const std::size_t num_chunks = num_lines/lines_per_chunk + (num_lines%lines_per_chunk ? 1 : 0);
+        const std::size_t num_threads = Threading::number_of_threads_for(num_chunks, _opts.num_threads);
+
+        if (num_threads == 1) {
+            Buffer buffer(buffer_size);
+            const auto flush = [&] (Buffer& b) { this->_write_raw(b.data()); b.clear(); };
+            for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+                const std::size_t first_line = chunk*lines_per_chunk;
+                _format_lines<PrintType>(data, first_line, std::min(lines_per_chunk, num_lines - first_line), buffer, flush);
+                flush(buffer);
             }
+            return;
         }
 
-        // flush remaining buffer content
-        buffer.prepare_readout();
-        this->_write_raw(buffer.data());
+        // format batches of chunks concurrently (each into its own buffer) and write them in order
+        std::vector<Buffer> buffers(num_threads, Buffer(buffer_size));
+        for (std::size_t batch_begin = 0; batch_begin < num_chunks; batch_begin += num_threads) {
+            const std::size_t num_batch_chunks = std::min(num_threads, num_chunks - batch_begin);
+            Threading::parallel_for(num_batch_chunks, num_threads, [&] (std::size_t i) {
+                const std::size_t first_line = (batch_begin + i)*lines_per_chunk;
+                buffers[i].clear();
+                _format_lines<PrintType>(
+                    data, first_line, std::min(lines_per_chunk, num_lines - first_line),
+                    buffers[i], [] (const Buffer&) { /* buffer grows as needed */ }
+                );
+            });
+            for (std::size_t i = 0; i < num_batch_chunks; ++i)
+                this->_write_raw(buffers[i].data());
+        }
+    }
+
+ private:
+    template<typename PrintType, typename T, std::size_t size, typename Flush>
+    void _format_lines(std::span<T, size> data,
+                       std::size_t first_line,
+                       std::size_t num_lines,
+                       Buffer& buffer,
+                       const Flush& flush) const {
+        const std::string_view delimiter = _opts.delimiter;
+        const std::string_view line_prefix = _opts.line_prefix;
+        const std::size_t max_entry_chars = max_value_chars + delimiter.size() + line_prefix.size() + 1;
+        const std::size_t entries_per_line = std::max(_opts.entries_per_line, std::size_t{1});
+        for (std::size_t line = first_line; line < first_line + num_lines; ++line) {
+            if (buffer.free_space() < max_entry_chars)
+                flush(buffer);
+            buffer.append(line > 0 ? "\n" : "");
+            buffer.append(line_prefix);
+
+            const std::size_t first_entry = line*entries_per_line;
+            const std::size_t num_entries = std::min(entries_per_line, data.size() - first_entry);
+            for (const auto& value : data.subspan(first_entry, num_entries)) {
+                if (buffer.free_space() < max_entry_chars)
+                    flush(buffer);
+                buffer.append_value(static_cast<PrintType>(value));
+                buffer.append(delimiter);
+            }
+        }
     }
 
     AsciiFormatOptions _opts;
 };
 
+//! Options for parsing ascii-encoded values
+struct AsciiDecoderOptions {
+    std::size_t chunk_size = (1 << 20);  //!< Number of characters read from the stream at once
+    std::size_t num_threads = 1;         //!< Number of threads used to parse a chunk (0 = all available)
+};
+
+/*!
+ * \brief Parses whitespace-separated ascii values from a stream.
+ * \details The stream is read in large chunks, in which the values are parsed with `std::from_chars`.
+ *          If multiple threads are requested, chunks are split at whitespace into pieces that are
+ *          parsed concurrently. Parsing stops at the end of the stream or at the beginning of an xml tag.
+ *          Streams reading from memory (see SpanInputStream) are parsed in place without chunking.
+ */
+class AsciiDecoder {
+    static constexpr std::size_t min_chunk_size_per_thread = (1 << 16);
+
+ public:
+    explicit AsciiDecoder(AsciiDecoderOptions opts = {})
+    : _opts{std::move(opts)}
+    {}
+
+    /*!
+     * \brief Parse values from the stream into the given buffer and return the number of parsed values.
+     * \note Reading stops once the buffer is full, and the stream is positioned behind the last parsed value.
+     */
+    template<Concepts::Scalar T, std::size_t s>
+    std::size_t decode_from(std::istream& stream, std::span<T, s> values) const {
+        if (values.empty())
+            return 0;
+
+        // parse directly from the underlying memory if possible
+        if (auto* span_buffer = SpanStreamBuffer::of(stream)) {
+            const auto available = span_buffer->remaining();
+            const std::string_view chars{available.data(), available.size()};
+            const auto [num_parsed, end] = _parse(chars.substr(0, chars.find('<')), values);
+            span_buffer->consume(end);
+            return num_parsed;
+        }
+
+        const auto begin_pos = stream.tellg();
+        const std::size_t chunk_size = std::max(_opts.chunk_size, std::size_t{1});
+        std::string buffer;
+        std::size_t buffer_offset = 0;  // position of the buffer begin relative to begin_pos
+        std::size_t num_carried = 0;    // characters of an incomplete value from the previous chunk
+        std::size_t num_values = 0;
+        while (true) {
+            buffer.resize(num_carried + chunk_size);
+            stream.read(buffer.data() + num_carried, static_cast<std::streamsize>(chunk_size));
+            const auto num_read = static_cast<std::size_t>(stream.gcount());
+
+            std::string_view chars{buffer.data(), num_carried + num_read};
+            const auto tag_begin = chars.find('<', num_carried);
+            const bool is_last_chunk = num_read < chunk_size || tag_begin != std::string_view::npos;
+            if (tag_begin != std::string_view::npos)
+                chars = chars.substr(0, tag_begin);
+
+            // the last value in this chunk may be continued in the next one
+            const std::size_t parse_end = is_last_chunk ? chars.size() : _end_of_last_separator(chars);
+            const auto [num_parsed, end] = _parse(chars.substr(0, parse_end), values.subspan(num_values));
+            num_values += num_parsed;
+
+            if (num_values == values.size() || is_last_chunk) {
+                stream.clear();
+                if (begin_pos != std::istream::pos_type(-1))
+                    stream.seekg(begin_pos + static_cast<std::streamoff>(buffer_offset + end));
+                return num_values;
+            }
+
+            num_carried = chars.size() - parse_end;
+            std::copy_n(buffer.data() + parse_end, num_carried, buffer.data());
+            buffer_offset += parse_end;
+        }
+    }
+
+ private:
+    static bool _is_whitespace(char c) {
+        return c == ' ' || c == '\n' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+    }
+
+    static std::size_t _end_of_last_separator(std::string_view chars) {
+        const auto it = std::find_if(chars.rbegin(), chars.rend(), _is_whitespace);
+        return static_cast<std::size_t>(std::distance(it, chars.rend()));
+    }
+
+    static std::size_t _skip_whitespace(std::string_view chars, std::size_t pos) {
+        while (pos < chars.size() && _is_whitespace(chars[pos]))
+            ++pos;
+        return pos;
+    }
+
+    static std::size_t _count_values(std::string_view chars) {
+        std::size_t count = 0;
+        bool in_value = false;
+        for (char c : chars) {
+            const bool is_value_char = !_is_whitespace(c);
+            count += is_value_char && !in_value;
+            in_value = is_value_char;
+        }
+        return count;
+    }
+
+    // parse values into the output buffer and return the number of values and the end position of the last one
+    template<typename T>
+    std::pair<std::size_t, std::size_t> _parse(std::string_view chars, std::span<T> out) const {
+        const std::size_t number_of_threads = Threading::number_of_threads_for(
+            chars.size()/min_chunk_size_per_thread, _opts.num_threads
+        );
+        if (number_of_threads == 1)
+            return _parse_serial(chars, out);
+
+        // split into pieces at whitespace, count the values in each piece, and parse them concurrently
+        std::vector<std::size_t> piece_begins(number_of_threads + 1, chars.size());
+        piece_begins[0] = 0;
+        for (std::size_t i = 1; i < number_of_threads; ++i)
+            piece_begins[i] = std::max(
+                piece_begins[i-1],
+                std::min(chars.find_first_of(" \n\t\r\f\v", i*(chars.size()/number_of_threads)), chars.size())
+            );
+
+        std::vector<std::size_t> value_offsets(number_of_threads + 1, 0);
+        Threading::parallel_for(number_of_threads, number_of_threads, [&] (std::size_t i) {
+            value_offsets[i+1] = _count_values(chars.substr(piece_begins[i], piece_begins[i+1] - piece_begins[i]));
+        });
+        std::partial_sum(value_offsets.begin(), value_offsets.end(), value_offsets.begin());
+
+        std::vector<std::pair<std::size_t, std::size_t>> results(number_of_threads, {0, 0});
+        Threading::parallel_for(number_of_threads, number_of_threads, [&] (std::size_t i) {
+            if (value_offsets[i] >= out.size())
+                return;
+            const auto piece = chars.substr(piece_begins[i], piece_begins[i+1] - piece_begins[i]);
+            const auto num_piece_values = std::min(value_offsets[i+1], out.size()) - value_offsets[i];
+            results[i] = _parse_serial(piece, out.subspan(value_offsets[i], num_piece_values));
+            results[i].second += piece_begins[i];
+        });
+
+        const auto last = std::ranges::find_if(results | std::views::reverse, [] (const auto& r) {
+            return r.first > 0;
+        });
+        const std::size_t end = last != std::ranges::end(results | std::views::reverse) ? (*last).second : 0;
+        return {std::min(value_offsets.back(), out.size()), end};
+    }
+
+    template<typename T>
+    std::pair<std::size_t, std::size_t> _parse_serial(std::string_view chars, std::span<T> out) const {
+        std::size_t count = 0;
+        std::size_t pos = 0;
+        std::size_t end = 0;
+        while (count < out.size()) {
+            pos = _skip_whitespace(chars, pos);
+            if (pos == chars.size())
+                break;
+            pos = _parse_value(chars, pos, out[count++]);
+            end = pos;
+        }
+        return {count, end};
+    }
+
+    template<typename T>
+    std::size_t _parse_value(std::string_view chars, std::size_t pos, T& value) const {
+        const std::size_t value_begin = pos;
+        if (chars[pos] == '+')  // not accepted by std::from_chars
+            ++pos;
+
+        const auto [ptr, ec] = _from_chars(chars.data() + pos, chars.data() + chars.size(), value);
+        const auto value_end = static_cast<std::size_t>(ptr - chars.data());
+        if (ec != std::errc{} || (value_end < chars.size() && !_is_whitespace(chars[value_end]))) {
+            const auto token_end = std::min(chars.find_first_of(" \n\t\r\f\v", value_begin), chars.size());
+            throw ValueError(
+                "Could not parse value of type '" + std::string{_type_name<T>()} + "' from '"
+                + std::string{chars.substr(value_begin, token_end - value_begin)} + "'"
+            );
+        }
+        return value_end;
+    }
+
+    template<typename T>
+    static std::from_chars_result _from_chars(const char* first, const char* last, T& value) {
+#if !__cpp_lib_to_chars
+        // floating-point support for std::from_chars is missing in some standard libraries
+        if constexpr (std::floating_point<T>) {
+            const char* token_end = std::find_if(first, last, _is_whitespace);
+            std::istringstream s{std::string{first, token_end}};
+            s.imbue(std::locale::classic());
+            s >> value;
+            if (s.fail() || s.peek() != std::istringstream::traits_type::eof())
+                return {first, std::errc::invalid_argument};
+            return {token_end, std::errc{}};
+        } else {
+            return std::from_chars(first, last, value);
+        }
+#else
+        return std::from_chars(first, last, value);
+#endif
+    }
+
+    template<typename T>
+    static constexpr std::string_view _type_name() {
+        if constexpr (std::floating_point<T>)
+            return "float";
+        else if constexpr (std::signed_integral<T>)
+            return "signed integer";
+        else
+            return "unsigned integer";
+    }
+
+    AsciiDecoderOptions _opts;
+};
+
 //! \} group Encoding
 
 }  // namespace GridFormat
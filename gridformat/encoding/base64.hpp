@@ -8,51 +8,38 @@
 #ifndef GRIDFORMAT_COMMON_ENCODING_BASE64_HPP_
 #define GRIDFORMAT_COMMON_ENCODING_BASE64_HPP_
 
+#include <span>
 #include <array>
 #include <vector>
+#include <cstddef>
 #include <utility>
 #include <cassert>
+#include <iterator>
 #include <algorithm>
 #include <istream>
 
 #include <gridformat/common/exceptions.hpp>
 #include <gridformat/common/serialization.hpp>
 #include <gridformat/common/istream_helper.hpp>
+#include <gridformat/common/span_stream.hpp>
 #include <gridformat/common/output_stream.hpp>
 #include <gridformat/common/concepts.hpp>
+#include <gridformat/encoding/detail/base64_kernels.hpp>
 
 namespace GridFormat {
 
-#ifndef DOXYGEN
-namespace Base64Detail {
-
-static constexpr auto alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-
-static constexpr std::array<unsigned char, 256> letter_to_index = [] {
-    std::array<unsigned char, 256> result;
-    std::ranges::fill(result, 0);
-    for (int i = 0; i < 64; ++i)
-        result[static_cast<unsigned>(alphabet[i])] = i;
-    return result;
-} ();
-
-}  // namespace Base64Detail
-#endif  // DOXYGEN
-
 namespace Base64 {
 
 //! Return the number of decoded bytes for the given number of encoded bytes
-std::size_t decoded_size(std::size_t encoded_size) {
+inline std::size_t decoded_size(std::size_t encoded_size) {
     if (encoded_size%4 != 0)
         throw SizeError("Given size is not a multiple of 4");
     return encoded_size*3/4;
 }
 
 //! Return the number of encoded bytes for the given number of raw bytes
-std::size_t encoded_size(std::size_t raw_size) {
-    return 4*static_cast<std::size_t>(
-        std::ceil(static_cast<double>(raw_size)/3.0)
-    );
+inline std::size_t encoded_size(std::size_t raw_size) {
+    return 4*((raw_size + 2)/3);
 }
 
 }  // namespace Base64
@@ -61,53 +48,137 @@ std::size_t encoded_size(std::size_t raw_size) {
 //! \{
 
 struct Base64Decoder {
+    static constexpr std::size_t decoded_group_size = 3;  //!< Number of bytes decoded from one group of characters
+    static constexpr std::size_t encoded_group_size = 4;  //!< Number of characters in one group
+
+    //! Read the encoded characters of the given number of bytes from the stream and decode them
     Serialization decode_from(std::istream& stream, std::size_t target_num_decoded_bytes) const {
-        InputStreamHelper helper{stream};
         const auto encoded_size = Base64::encoded_size(target_num_decoded_bytes);
-        std::string chars = helper.read_until_any_of("=", encoded_size);
-        if (chars.size() != encoded_size)
-            chars += helper.read_until_not_any_of("=");
-
-        Serialization result{chars.size()};
-        auto result_chars = result.template as_span_of<char>();
-        std::ranges::move(std::move(chars), result_chars.begin());
-        result.resize(decode(result_chars));
+
+        // decode directly from the underlying memory if possible
+        if (auto* span_buffer = SpanStreamBuffer::of(stream)) {
+            const auto available = span_buffer->remaining();
+            const auto chars = available.first(_end_of_encoded(available.first(std::min(encoded_size, available.size()))));
+            Serialization result{chars.size()/4*3};
+            result.resize(_decode(chars, result.template as_span_of<char>().data()));
+            span_buffer->consume(chars.size());
+            return result;
+        }
+
+        // read the characters directly into the result buffer, and decode them in-place
+        Serialization result{encoded_size};
+        auto chars = result.template as_span_of<char>();
+
+        InputStreamHelper helper{stream};
+        const auto begin = helper.position();
+        stream.read(chars.data(), chars.size());
+        const std::size_t num_read = static_cast<std::size_t>(stream.gcount());
+        stream.clear();
+
+        const std::size_t num_chars = _end_of_encoded(chars.first(num_read));
+        if (num_chars != num_read)
+            helper.seek_position(begin + static_cast<std::streamsize>(num_chars));
+
+        result.resize(decode(chars.first(num_chars)));
         return result;
     }
 
+    //! Read the encoded characters of out.size() bytes from the stream and decode them directly into out
+    void decode_from(std::istream& stream, std::span<std::byte> out) const {
+        const auto encoded_size = Base64::encoded_size(out.size());
+        const std::span<char> out_chars{reinterpret_cast<char*>(out.data()), out.size()};
+
+        if (auto* span_buffer = SpanStreamBuffer::of(stream)) {
+            const auto available = span_buffer->remaining();
+            if (available.size() < encoded_size)
+                throw SizeError("Could not read the requested number of bytes from the stream");
+            _decode_into(available.first(encoded_size), out_chars);
+            span_buffer->consume(encoded_size);
+            return;
+        }
+
+        // read & decode chunk-wise, such that only a small buffer for the encoded characters is needed
+        std::vector<char> buffer(std::min(encoded_size, decode_chunk_size));
+        std::size_t num_encoded = 0;
+        std::size_t num_decoded = 0;
+        while (num_encoded < encoded_size) {
+            const std::size_t n = std::min(buffer.size(), encoded_size - num_encoded);
+            stream.read(buffer.data(), static_cast<std::streamsize>(n));
+            if (static_cast<std::size_t>(stream.gcount()) != n)
+                throw SizeError("Could not read the requested number of bytes from the stream");
+
+            num_encoded += n;
+            const auto chars = std::span{buffer}.first(n);
+            if (num_encoded < encoded_size) {
+                if (!Base64Detail::decode(chars.data(), n/4, out_chars.data() + num_decoded))
+                    throw ValueError("Invalid character in base64-encoded data");
+                num_decoded += n/4*3;
+            } else {
+                _decode_into(chars, out_chars.subspan(num_decoded));
+            }
+        }
+    }
+
+    //! Decode the given characters in-place and return the number of decoded bytes
     template<std::size_t s>
     std::size_t decode(std::span<char, s> chars) const {
+        return _decode(chars, chars.data());
+    }
+
+ private:
+    static constexpr std::size_t decode_chunk_size = 4*(1 << 16);
+
+    // decode the given characters into the given output, which must match the number of decoded bytes
+    void _decode_into(std::span<const char> chars, std::span<char> out) const {
         if (chars.size() == 0)
-            return 0;
+            return;
         if (chars.size()%4 != 0)
             throw SizeError("Buffer size is not a multiple of 4");
 
-        std::size_t in_offset = 0;
-        std::size_t out_offset = 0;
-        while (in_offset < chars.size()) {
-            std::ranges::copy(
-                _decode_triplet(chars.data() + in_offset),
-                chars.data() + out_offset
-            );
-            in_offset += 4;
-            out_offset += 3;
-        }
+        const std::size_t num_leading_quartets = chars.size()/4 - 1;
+        std::array<char, 3> last_triplet;
+        const std::size_t num_last = _decode(chars.last(4), last_triplet.data());
+        if (3*num_leading_quartets + num_last != out.size())
+            throw SizeError("Number of decoded bytes does not match the size of the output");
+        if (!Base64Detail::decode(chars.data(), num_leading_quartets, out.data()))
+            throw ValueError("Invalid character in base64-encoded data");
+        std::copy_n(last_triplet.begin(), num_last, out.data() + 3*num_leading_quartets);
+    }
 
-        const auto end_chars = chars.subspan(chars.size() - 3);
-        std::string_view end_str{end_chars.data(), end_chars.size()};
-        const auto num_padding_chars = std::ranges::count(end_str, '=');
-        return out_offset - (num_padding_chars > 0 ? num_padding_chars : 0);
+    // encoded data ends after padding characters (if any)
+    static std::size_t _end_of_encoded(std::span<const char> chars) {
+        const auto padding_begin = std::ranges::find(chars, '=');
+        const auto padding_end = std::find_if(padding_begin, chars.end(), [] (char c) { return c != '='; });
+        return padding_begin != chars.end()
+            ? static_cast<std::size_t>(std::distance(chars.begin(), padding_end))
+            : chars.size();
     }
 
- private:
-    std::array<char, 3> _decode_triplet(const char* in) const {
-        using Base64Detail::letter_to_index;
-        std::array<char, 3> result;
-        result[0] = ((letter_to_index[in[0]] & 0b0011'1111) << 2) | ((letter_to_index[in[1]] & 0b0011'0000) >> 4);
-        result[1] = ((letter_to_index[in[1]] & 0b0000'1111) << 4) | ((letter_to_index[in[2]] & 0b0011'1100) >> 2);
-        result[2] = ((letter_to_index[in[2]] & 0b0000'0011) << 6) | ((letter_to_index[in[3]] & 0b0011'1111));
-        return result;
-    };
+    // decode the given characters into the given output (may alias the input)
+    std::size_t _decode(std::span<const char> chars, char* out) const {
+        if (chars.size() == 0)
+            return 0;
+        if (chars.size()%4 != 0)
+            throw SizeError("Buffer size is not a multiple of 4");
+
+        const std::size_t num_quartets = chars.size()/4;
+        const std::size_t num_padding_chars = chars.back() != '=' ? 0 : (chars[chars.size() - 2] == '=' ? 2 : 1);
+        const std::size_t num_full_quartets = num_padding_chars > 0 ? num_quartets - 1 : num_quartets;
+
+        std::array<char, 4> last_quartet;
+        std::ranges::copy(chars.last(4), last_quartet.begin());
+        if (!Base64Detail::decode(chars.data(), num_full_quartets, out))
+            throw ValueError("Invalid character in base64-encoded data");
+
+        if (num_padding_chars > 0) {
+            std::fill_n(last_quartet.end() - num_padding_chars, num_padding_chars, 'A');
+            std::array<char, 3> last_triplet;
+            if (!Base64Detail::decode_scalar(last_quartet.data(), 1, last_triplet.data()))
+                throw ValueError("Invalid character in base64-encoded data");
+            std::copy_n(last_triplet.begin(), 3 - num_padding_chars, out + 3*num_full_quartets);
+        }
+        return 3*num_quartets - num_padding_chars;
+    }
 };
 
 //! Options for formatted output of ranges with base64 encoding
@@ -123,25 +194,6 @@ class Base64Stream : public OutputStreamWrapperBase<OStream> {
     static constexpr int buffer_size = 3;
     static constexpr int encoded_buffer_size = 4;
 
-    // Top 6 bits of byte 0
-    inline Byte _encode_sextet_0(const Byte* buffer) const {
-        return Base64Detail::alphabet[((buffer[0] & 0b1111'1100) >> 2)];
-    }
-    // Bottom 2 bits of byte 0, Top 4 bits of byte 1
-    inline Byte _encode_sextet_1(const Byte* buffer) const {
-        return Base64Detail::alphabet[((buffer[0] & 0b0000'0011) << 4)
-               | ((buffer[1] & 0b1111'0000) >> 4)];
-    }
-    // Bottom 4 bits of byte 1, Top 2 bits of byte 2
-    inline Byte _encode_sextet_2(const Byte* buffer) const {
-        return Base64Detail::alphabet[((buffer[1] & 0b0000'1111) << 2)
-               | ((buffer[2] & 0b1100'0000) >> 6)];
-    }
-    // Bottom 6 bits of byte 2
-    inline Byte _encode_sextet_3(const Byte* buffer) const {
-        return Base64Detail::alphabet[(buffer[2] & 0b0011'1111)];
-    }
-
  public:
     explicit Base64Stream(OStream& s, Base64EncoderOptions opts = {})
     : OutputStreamWrapperBase<OStream>(s)
@@ -156,71 +208,44 @@ class Base64Stream : public OutputStreamWrapperBase<OStream> {
     }
 
  private:
-    std::size_t _cache_size_in() const { return _opts.num_cached_buffers*buffer_size; }
-    std::size_t _cache_size_out() const { return _opts.num_cached_buffers*encoded_buffer_size; }
+    std::size_t _cache_size_in() const { return std::max(_opts.num_cached_buffers, std::size_t{1})*buffer_size; }
 
     void _write(const Byte* data, std::size_t size) {
-        const auto num_full_buffers = size/buffer_size;
-        const auto num_full_caches = num_full_buffers/_opts.num_cached_buffers;
-        for (const auto i : std::views::iota(std::size_t{0}, num_full_caches))
-            _flush_full_cache(data + i*_cache_size_in());
-
-        const auto processed_bytes = num_full_caches*_cache_size_in();
-        if (size > processed_bytes)
-            _flush_cache(data + processed_bytes, size - processed_bytes);
-    }
-
-    void _flush_full_cache(const Byte* data) {
-        std::vector<Byte> cache(_cache_size_out());
-        for (std::size_t i = 0; i < _cache_size_out()/encoded_buffer_size; ++i) {
-            const std::size_t in_offset = i*buffer_size;
-            const std::size_t out_offset = i*encoded_buffer_size;
-            cache[out_offset + 0] = _encode_sextet_0(data + in_offset);
-            cache[out_offset + 1] = _encode_sextet_1(data + in_offset);
-            cache[out_offset + 2] = _encode_sextet_2(data + in_offset);
-            cache[out_offset + 3] = _encode_sextet_3(data + in_offset);
+        while (size > 0) {
+            const std::size_t num_bytes = std::min(size, _cache_size_in());
+            _flush_cache(data, num_bytes);
+            data += num_bytes;
+            size -= num_bytes;
         }
-        this->_stream.write(std::span{cache});
     }
 
+    // encode the given bytes into the cache (reused across write operations) and write it
     void _flush_cache(const Byte* data, std::size_t num_bytes_in) {
-        if (num_bytes_in == 0)
-            return;
-        if (num_bytes_in > _cache_size_in())
-            throw SizeError("Number of bytes cannot be larger than cache size");
-
         const std::size_t num_full_buffers = num_bytes_in/buffer_size;
         const std::size_t residual = num_bytes_in%buffer_size;
+        const std::size_t num_bytes_out = Base64::encoded_size(num_bytes_in);
+        if (_cache.size() < num_bytes_out)
+            _cache.resize(num_bytes_out);
 
-        std::vector<Byte> cache(_cache_size_out());
-        for (std::size_t i = 0; i < num_full_buffers; ++i) {
-            const std::size_t in_offset = i*buffer_size;
-            const std::size_t out_offset = i*encoded_buffer_size;
-            cache[out_offset + 0] = _encode_sextet_0(data + in_offset);
-            cache[out_offset + 1] = _encode_sextet_1(data + in_offset);
-            cache[out_offset + 2] = _encode_sextet_2(data + in_offset);
-            cache[out_offset + 3] = _encode_sextet_3(data + in_offset);
-        }
-
-        const std::size_t in_offset = num_full_buffers*buffer_size;
-        const std::size_t out_offset = num_full_buffers*encoded_buffer_size;
+        Base64Detail::encode(data, num_full_buffers, _cache.data());
         if (residual > 0) {
-            Byte last_buffer[buffer_size] = {
-                *(data + in_offset),
-                residual > 1 ? *(data + in_offset + 1) : Byte{0},
-                residual > 2 ? *(data + in_offset + 2) : Byte{0}
+            const std::size_t in_offset = num_full_buffers*buffer_size;
+            const std::size_t out_offset = num_full_buffers*encoded_buffer_size;
+            const Byte last_buffer[buffer_size] = {
+                data[in_offset],
+                residual > 1 ? data[in_offset + 1] : Byte{0},
+                Byte{0}
             };
-            cache[out_offset] = _encode_sextet_0(last_buffer);
-            cache[out_offset + 1] = _encode_sextet_1(last_buffer);
-            cache[out_offset + 2] = residual > 1 ? _encode_sextet_2(last_buffer) : '=';
-            cache[out_offset + 3] = residual > 2 ? _encode_sextet_3(last_buffer) : '=';
-            this->_stream.write(std::span{cache.data(), out_offset + 4});
-        } else {
-            this->_stream.write(std::span{cache.data(), out_offset});
+            Base64Detail::encode_scalar(last_buffer, 1, _cache.data() + out_offset);
+            if (residual < 2)
+                _cache[out_offset + 2] = '=';
+            _cache[out_offset + 3] = '=';
         }
+        this->_stream.write(std::span{_cache.data(), num_bytes_out});
     }
 
     Base64EncoderOptions _opts;
+    std::vector<Byte> _cache;
 };
 
 //! \} group Encoding
@@ -0,0 +1,334 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+#ifndef GRIDFORMAT_ENCODING_DETAIL_BASE64_KERNELS_HPP_
+#define GRIDFORMAT_ENCODING_DETAIL_BASE64_KERNELS_HPP_
+#ifndef DOXYGEN
+
+#include <array>
+#include <cstddef>
+#include <algorithm>
+
+// On x86-64, vectorized kernels are compiled via function attributes and selected at runtime
+// depending on the capabilities of the cpu. This can be disabled by defining GRIDFORMAT_DISABLE_SIMD.
+#if !defined(GRIDFORMAT_DISABLE_SIMD) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define GRIDFORMAT_HAVE_X86_SIMD_KERNELS 1
+#include <immintrin.h>
+#else
+#define GRIDFORMAT_HAVE_X86_SIMD_KERNELS 0
+#endif
+
+namespace GridFormat::Base64Detail {
+
+static constexpr auto alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static constexpr unsigned char invalid_letter = 0xff;
+static constexpr std::array<unsigned char, 256> letter_to_index = [] {
+    std::array<unsigned char, 256> result;
+    std::ranges::fill(result, invalid_letter);
+    for (int i = 0; i < 64; ++i)
+        result[static_cast<unsigned>(alphabet[i])] = i;
+    return result;
+} ();
+
+//! Signature of kernels that encode a number of full triplets (writing four characters per triplet)
+using EncodeKernel = void(*)(const char* in, std::size_t num_triplets, char* out);
+
+inline void encode_scalar(const char* in, std::size_t num_triplets, char* out) {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(in);
+    for (std::size_t i = 0; i < num_triplets; ++i, bytes += 3, out += 4) {
+        out[0] = alphabet[bytes[0] >> 2];
+        out[1] = alphabet[((bytes[0] & 0b0000'0011) << 4) | (bytes[1] >> 4)];
+        out[2] = alphabet[((bytes[1] & 0b0000'1111) << 2) | (bytes[2] >> 6)];
+        out[3] = alphabet[bytes[2] & 0b0011'1111];
+    }
+}
+
+//! Signature of kernels that decode a number of quartets (writing three bytes per quartet),
+//! returning false if invalid characters were encountered. Input and output may alias (in-place).
+using DecodeKernel = bool(*)(const char* in, std::size_t num_quartets, char* out);
+
+inline bool decode_scalar(const char* in, std::size_t num_quartets, char* out) {
+    const auto* chars = reinterpret_cast<const unsigned char*>(in);
+    auto* bytes = reinterpret_cast<unsigned char*>(out);
+    for (std::size_t i = 0; i < num_quartets; ++i, chars += 4, bytes += 3) {
+        const unsigned a = letter_to_index[chars[0]];
+        const unsigned b = letter_to_index[chars[1]];
+        const unsigned c = letter_to_index[chars[2]];
+        const unsigned d = letter_to_index[chars[3]];
+        if ((a | b | c | d) & 0b1100'0000)
+            return false;
+        bytes[0] = static_cast<unsigned char>((a << 2) | (b >> 4));
+        bytes[1] = static_cast<unsigned char>(((b & 0b0000'1111) << 4) | (c >> 2));
+        bytes[2] = static_cast<unsigned char>(((c & 0b0000'0011) << 6) | d);
+    }
+    return true;
+}
+
+#if GRIDFORMAT_HAVE_X86_SIMD_KERNELS
+
+// The 128/256-bit kernels follow W. Muła & D. Lemire, "Faster Base64 Encoding and Decoding
+// using AVX2 Instructions" (2018): reshuffle the triplets such that each 32-bit word holds
+// the bytes of one triplet, extract the sextets with multiplications, and translate the sextets
+// into ascii characters by adding offsets looked up per range of the alphabet.
+
+__attribute__((target("ssse3")))
+inline __m128i encode_16_ssse3(__m128i in) {
+    in = _mm_shuffle_epi8(in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t1, t3);
+
+    __m128i offset_ids = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i is_upper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    offset_ids = _mm_or_si128(offset_ids, _mm_and_si128(is_upper, _mm_set1_epi8(13)));
+    const __m128i offsets = _mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0
+    );
+    return _mm_add_epi8(_mm_shuffle_epi8(offsets, offset_ids), indices);
+}
+
+__attribute__((target("ssse3")))
+inline void encode_ssse3(const char* in, std::size_t num_triplets, char* out) {
+    std::size_t i = 0;
+    for (; i + 6 <= num_triplets; i += 4) {  // encodes 4 triplets, but reads 16 bytes
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 3*i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 4*i), encode_16_ssse3(v));
+    }
+    encode_scalar(in + 3*i, num_triplets - i, out + 4*i);
+}
+
+__attribute__((target("avx2")))
+inline __m256i encode_32_avx2(__m256i in) {
+    in = _mm256_shuffle_epi8(in, _mm256_setr_epi8(
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10
+    ));
+    const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    const __m256i indices = _mm256_or_si256(t1, t3);
+
+    __m256i offset_ids = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    const __m256i is_upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+    offset_ids = _mm256_or_si256(offset_ids, _mm256_and_si256(is_upper, _mm256_set1_epi8(13)));
+    const __m256i offsets = _mm256_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0
+    );
+    return _mm256_add_epi8(_mm256_shuffle_epi8(offsets, offset_ids), indices);
+}
+
+__attribute__((target("avx2")))
+inline void encode_avx2(const char* in, std::size_t num_triplets, char* out) {
+    std::size_t i = 0;
+    for (; i + 10 <= num_triplets; i += 8) {  // encodes 8 triplets, but reads 28 bytes
+        const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 3*i));
+        const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 3*i + 12));
+        const __m256i v = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 4*i), encode_32_avx2(v));
+    }
+    encode_scalar(in + 3*i, num_triplets - i, out + 4*i);
+}
+
+// GCC's avx-512 intrinsics use self-initialized "undefined" vectors, which trigger false positives
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+// see W. Muła & D. Lemire, "Base64 encoding and decoding at almost the speed of a memory copy" (2019)
+__attribute__((target("avx512f,avx512bw,avx512vbmi")))
+inline void encode_avx512vbmi(const char* in, std::size_t num_triplets, char* out) {
+    const __m512i lookup = _mm512_loadu_si512(reinterpret_cast<const void*>(alphabet));
+    const __m512i shuffle = _mm512_setr_epi32(
+        0x01020001, 0x04050304, 0x07080607, 0x0a0b090a,
+        0x0d0e0c0d, 0x10110f10, 0x13141213, 0x16171516,
+        0x191a1819, 0x1c1d1b1c, 0x1f201e1f, 0x22232122,
+        0x25262425, 0x28292728, 0x2b2c2a2b, 0x2e2f2d2e
+    );
+    const __m512i shifts = _mm512_set1_epi64(0x3036242a1016040a);
+
+    std::size_t i = 0;
+    for (; i + 16 <= num_triplets; i += 16) {
+        const __m512i v = _mm512_maskz_loadu_epi8(0x0000'ffff'ffff'ffff, in + 3*i);
+        const __m512i triplets = _mm512_permutexvar_epi8(shuffle, v);
+        const __m512i indices = _mm512_multishift_epi64_epi8(shifts, triplets);
+        _mm512_storeu_si512(reinterpret_cast<void*>(out + 4*i), _mm512_permutexvar_epi8(indices, lookup));
+    }
+    encode_scalar(in + 3*i, num_triplets - i, out + 4*i);
+}
+
+// The 128/256-bit decoding kernels validate the characters with lookups on the high and low nibbles,
+// translate them into sextets by adding offsets looked up per range of the alphabet, and merge the
+// sextets of each quartet with multiply-add instructions (see the reference given above).
+// The loop bounds ensure that no more than 3*num_quartets bytes are written.
+
+__attribute__((target("ssse3")))
+inline bool decode_16_ssse3(__m128i in, __m128i& out) {
+    const __m128i lut_lo = _mm_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a
+    );
+    const __m128i lut_hi = _mm_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+    );
+    const __m128i lut_roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(in, 4), _mm_set1_epi8(0x0f));
+    const __m128i lo_nibbles = _mm_and_si128(in, _mm_set1_epi8(0x0f));
+    const __m128i lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+    const __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0xffff)
+        return false;
+
+    const __m128i is_slash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+    const __m128i roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(is_slash, hi_nibbles));
+    const __m128i sextets = _mm_add_epi8(in, roll);
+    const __m128i merged_pairs = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+    const __m128i merged = _mm_madd_epi16(merged_pairs, _mm_set1_epi32(0x00011000));
+    out = _mm_shuffle_epi8(merged, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    return true;
+}
+
+__attribute__((target("ssse3")))
+inline bool decode_ssse3(const char* in, std::size_t num_quartets, char* out) {
+    std::size_t i = 0;
+    for (; i + 6 <= num_quartets; i += 4) {  // decodes 4 quartets, but writes 16 bytes
+        __m128i decoded;
+        if (!decode_16_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 4*i)), decoded))
+            return false;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 3*i), decoded);
+    }
+    return decode_scalar(in + 4*i, num_quartets - i, out + 3*i);
+}
+
+__attribute__((target("avx2")))
+inline bool decode_avx2(const char* in, std::size_t num_quartets, char* out) {
+    const __m256i lut_lo = _mm256_setr_epi8(
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a
+    );
+    const __m256i lut_hi = _mm256_setr_epi8(
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+    );
+    const __m256i lut_roll = _mm256_setr_epi8(
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0
+    );
+    const __m256i pack_lanes = _mm256_setr_epi8(
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1
+    );
+    const __m256i pack = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1);
+
+    std::size_t i = 0;
+    for (; i + 11 <= num_quartets; i += 8) {  // decodes 8 quartets, but writes 32 bytes
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + 4*i));
+        const __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(v, 4), _mm256_set1_epi8(0x0f));
+        const __m256i lo_nibbles = _mm256_and_si256(v, _mm256_set1_epi8(0x0f));
+        const __m256i lo = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+        const __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+        if (!_mm256_testz_si256(lo, hi))
+            return false;
+
+        const __m256i is_slash = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('/'));
+        const __m256i roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(is_slash, hi_nibbles));
+        const __m256i sextets = _mm256_add_epi8(v, roll);
+        const __m256i merged_pairs = _mm256_maddubs_epi16(sextets, _mm256_set1_epi32(0x01400140));
+        const __m256i merged = _mm256_madd_epi16(merged_pairs, _mm256_set1_epi32(0x00011000));
+        const __m256i packed = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(merged, pack_lanes), pack);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 3*i), packed);
+    }
+    return decode_scalar(in + 4*i, num_quartets - i, out + 3*i);
+}
+
+// translation table for the 7-bit ascii range (0x80 marks invalid characters)
+static constexpr std::array<unsigned char, 128> ascii_to_sextet = [] {
+    std::array<unsigned char, 128> result;
+    for (std::size_t i = 0; i < result.size(); ++i)
+        result[i] = letter_to_index[i] == invalid_letter ? 0x80 : letter_to_index[i];
+    return result;
+} ();
+
+// byte permutation gathering the three significant bytes of each 32-bit word
+static constexpr std::array<unsigned char, 64> decode_pack_avx512 = [] {
+    std::array<unsigned char, 64> result;
+    std::ranges::fill(result, 0);
+    for (std::size_t i = 0; i < 48; ++i)
+        result[i] = static_cast<unsigned char>(4*(i/3) + 2 - i%3);
+    return result;
+} ();
+
+__attribute__((target("avx512f,avx512bw,avx512vbmi")))
+inline bool decode_avx512vbmi(const char* in, std::size_t num_quartets, char* out) {
+    const __m512i lookup_lo = _mm512_loadu_si512(reinterpret_cast<const void*>(ascii_to_sextet.data()));
+    const __m512i lookup_hi = _mm512_loadu_si512(reinterpret_cast<const void*>(ascii_to_sextet.data() + 64));
+    const __m512i pack = _mm512_loadu_si512(reinterpret_cast<const void*>(decode_pack_avx512.data()));
+
+    std::size_t i = 0;
+    for (; i + 16 <= num_quartets; i += 16) {
+        const __m512i v = _mm512_loadu_si512(reinterpret_cast<const void*>(in + 4*i));
+        const __m512i sextets = _mm512_permutex2var_epi8(lookup_lo, v, lookup_hi);
+        if (_mm512_movepi8_mask(_mm512_or_si512(sextets, v)) != 0)
+            return false;
+
+        const __m512i merged_pairs = _mm512_maddubs_epi16(sextets, _mm512_set1_epi32(0x01400140));
+        const __m512i merged = _mm512_madd_epi16(merged_pairs, _mm512_set1_epi32(0x00011000));
+        _mm512_mask_storeu_epi8(out + 3*i, 0x0000'ffff'ffff'ffff, _mm512_permutexvar_epi8(pack, merged));
+    }
+    return decode_scalar(in + 4*i, num_quartets - i, out + 3*i);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif  // GRIDFORMAT_HAVE_X86_SIMD_KERNELS
+
+inline EncodeKernel select_encode_kernel() {
+#if GRIDFORMAT_HAVE_X86_SIMD_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512vbmi") && __builtin_cpu_supports("avx512bw"))
+        return &encode_avx512vbmi;
+    if (__builtin_cpu_supports("avx2"))
+        return &encode_avx2;
+    if (__builtin_cpu_supports("ssse3"))
+        return &encode_ssse3;
+#endif
+    return &encode_scalar;
+}
+
+//! Encode the given number of full triplets with the best kernel available on this cpu
+inline void encode(const char* in, std::size_t num_triplets, char* out) {
+    static const EncodeKernel kernel = select_encode_kernel();
+    kernel(in, num_triplets, out);
+}
+
+inline DecodeKernel select_decode_kernel() {
+#if GRIDFORMAT_HAVE_X86_SIMD_KERNELS
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512vbmi") && __builtin_cpu_supports("avx512bw"))
+        return &decode_avx512vbmi;
+    if (__builtin_cpu_supports("avx2"))
+        return &decode_avx2;
+    if (__builtin_cpu_supports("ssse3"))
+        return &decode_ssse3;
+#endif
+    return &decode_scalar;
+}
+
+//! Decode the given number of quartets (without padding) with the best kernel available on this cpu
+inline bool decode(const char* in, std::size_t num_quartets, char* out) {
+    static const DecodeKernel kernel = select_decode_kernel();
+    return kernel(in, num_quartets, out);
+}
+
+}  // namespace GridFormat::Base64Detail
+
+#endif  // DOXYGEN
+#endif  // GRIDFORMAT_ENCODING_DETAIL_BASE64_KERNELS_HPP_
@@ -10,6 +10,7 @@
 
 #include <span>
 #include <istream>
+#include <cstddef>
 
 #include <gridformat/common/serialization.hpp>
 #include <gridformat/common/output_stream.hpp>
@@ -21,6 +22,9 @@ namespace GridFormat {
 
 //! For compatibility with Base64
 struct RawDecoder {
+    static constexpr std::size_t decoded_group_size = 1;  //!< Number of bytes decoded from one group of characters
+    static constexpr std::size_t encoded_group_size = 1;  //!< Number of characters in one group
+
     Serialization decode_from(std::istream& stream, std::size_t num_decoded_bytes) const {
         Serialization result{num_decoded_bytes};
         auto chars = result.template as_span_of<char>();
@@ -30,6 +34,13 @@ struct RawDecoder {
         return result;
     }
 
+    //! Read out.size() bytes from the stream directly into out
+    void decode_from(std::istream& stream, std::span<std::byte> out) const {
+        stream.read(reinterpret_cast<char*>(out.data()), static_cast<std::streamsize>(out.size()));
+        if (stream.gcount() != static_cast<std::streamsize>(out.size()))
+            throw IOError("Could not read the requested number of bytes from input stream");
+    }
+
     template<std::size_t s>
     std::size_t decode(std::span<char, s> chars) const {
         return chars.size();
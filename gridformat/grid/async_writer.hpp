@@ -0,0 +1,271 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Grid
+ * \copydoc GridFormat::AsyncWriter
+ */
+#ifndef GRIDFORMAT_GRID_ASYNC_WRITER_HPP_
+#define GRIDFORMAT_GRID_ASYNC_WRITER_HPP_
+
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <future>
+#include <thread>
+#include <utility>
+#include <cstddef>
+#include <optional>
+#include <concepts>
+#include <algorithm>
+#include <type_traits>
+#include <condition_variable>
+
+#include <gridformat/common/field.hpp>
+#include <gridformat/common/md_layout.hpp>
+#include <gridformat/common/precision.hpp>
+#include <gridformat/common/serialization.hpp>
+#include <gridformat/common/exceptions.hpp>
+
+#include <gridformat/grid/writer.hpp>
+
+namespace GridFormat {
+
+#ifndef DOXYGEN
+namespace AsyncWriterDetail {
+
+    //! Field that holds a copy of the serialized values of another field
+    class SnapshotField : public Field {
+     public:
+        explicit SnapshotField(const Field& field)
+        : _md_layout{field.layout()}
+        , _prec{field.precision()}
+        , _data{_snapshot(field)}
+        {}
+
+     private:
+        static Serialization _snapshot(const Field& field) {
+            if (const auto bytes = field.contiguous_bytes()) {
+                Serialization result{bytes->size()};
+                std::ranges::copy(*bytes, result.as_span().begin());
+                return result;
+            }
+            return field.serialized();
+        }
+
+        MDLayout _layout() const override {
+            return _md_layout;
+        }
+
+        DynamicPrecision _precision() const override {
+            return _prec;
+        }
+
+        std::optional<std::span<const std::byte>> _contiguous_bytes() const override {
+            return _data.as_span();
+        }
+
+        Serialization _serialized() const override {
+            return _data;
+        }
+
+        MDLayout _md_layout;
+        DynamicPrecision _prec;
+        Serialization _data;
+    };
+
+}  // namespace AsyncWriterDetail
+#endif  // DOXYGEN
+
+//! \addtogroup Grid
+//! \{
+
+//! Options for asynchronous writers
+struct AsyncWriterOptions {
+    std::size_t max_pending_writes = 1;  //!< Number of writes that may be pending before write() blocks
+};
+
+/*!
+ * \brief Front-end for grid (time series) writers that performs the writes on a background thread.
+ * \details Fields are registered on this writer as on any other writer. Upon a call to write(), the
+ *          values of all registered fields are evaluated and copied on the calling thread, while the
+ *          actual write (compression, encoding, I/O) is done by the wrapped writer on a background
+ *          thread. Thus, fields may be changed as soon as write() returns. The returned future yields
+ *          the name of the written file, or rethrows the exception that occurred during the write. If
+ *          the given maximum number of writes is pending, write() blocks until one of them is done.
+ * \note The grid is not copied, and it must not change as long as writes are pending (see wait()).
+ * \note Parallel writers communicate from the background thread, which requires the communication
+ *       library to support this (e.g. MPI initialized with `MPI_THREAD_SERIALIZED`).
+ * \note Instances of this class are not meant to be used by multiple threads concurrently.
+ */
+template<typename W>
+class AsyncWriter : public GridWriterBase<typename W::Grid> {
+    using ParentType = GridWriterBase<typename W::Grid>;
+    using Task = std::packaged_task<std::string()>;
+
+    struct Snapshot {
+        std::vector<std::pair<std::string, FieldPtr>> meta_data;
+        std::vector<std::pair<std::string, FieldPtr>> point_fields;
+        std::vector<std::pair<std::string, FieldPtr>> cell_fields;
+    };
+
+    static constexpr bool is_time_series_writer = std::derived_from<W, TimeSeriesGridWriter<typename W::Grid>>;
+    static constexpr bool is_grid_writer = std::derived_from<W, GridWriter<typename W::Grid>>;
+    static_assert(is_time_series_writer || is_grid_writer, "Given type is not a (time series) grid writer");
+
+ public:
+    using Grid = typename W::Grid;
+    using Writer = W;
+
+    /*!
+     * \brief Construct an asynchronous writer from the given writer.
+     * \note Fields that were already registered on the given writer are taken over.
+     */
+    explicit AsyncWriter(W&& writer, AsyncWriterOptions opts = {})
+    : ParentType(writer.grid(), writer.writer_options())
+    , _writer{std::move(writer)}
+    , _opts{std::move(opts)} {
+        if (_opts.max_pending_writes == 0)
+            throw ValueError("Maximum number of pending writes must be positive");
+        _writer.copy_fields(*this);
+        _writer.clear();
+        _worker = std::thread{[&] () { _work(); }};
+    }
+
+    AsyncWriter(AsyncWriter&&) = delete;
+    AsyncWriter(const AsyncWriter&) = delete;
+    AsyncWriter& operator=(AsyncWriter&&) = delete;
+    AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+    //! Finishes all pending writes before destruction
+    ~AsyncWriter() {
+        {
+            std::lock_guard lock{_mutex};
+            _stop = true;
+        }
+        _task_available.notify_one();
+        _worker.join();
+    }
+
+    /*!
+     * \brief Write the grid and data to a file in the background.
+     * \param filename The name of file into which to write (without extension).
+     */
+    std::future<std::string> write(const std::string& filename) requires(is_grid_writer) {
+        return _submit([filename] (W& w) { return w.write(filename); });
+    }
+
+    /*!
+     * \brief Write a time step in a time series in the background.
+     * \param t The time corresponding to this time step.
+     */
+    std::future<std::string> write(double t) requires(is_time_series_writer) {
+        return _submit([t] (W& w) { return w.write(t); });
+    }
+
+    //! Wait until all pending writes are done
+    void wait() const {
+        std::unique_lock lock{_mutex};
+        _slot_available.wait(lock, [&] () { return _pending == 0; });
+    }
+
+    //! Return the number of writes that are queued or in progress
+    std::size_t number_of_pending_writes() const {
+        std::lock_guard lock{_mutex};
+        return _pending;
+    }
+
+    //! Return the communicator of the wrapped (parallel) writer
+    decltype(auto) communicator() const requires(requires(const W& w) { { w.communicator() }; }) {
+        return _writer.communicator();
+    }
+
+ private:
+    template<typename Action>
+    std::future<std::string> _submit(Action&& action) {
+        {
+            std::unique_lock lock{_mutex};
+            _slot_available.wait(lock, [&] () { return _pending < _opts.max_pending_writes; });
+            _pending++;
+        }
+
+        try {
+            Task task{[&w=_writer, s=_make_snapshot(), a=std::move(action)] () {
+                w.clear();
+                for (const auto& [name, field_ptr] : s.meta_data)
+                    w.set_meta_data(name, field_ptr);
+                for (const auto& [name, field_ptr] : s.point_fields)
+                    w.set_point_field(name, field_ptr);
+                for (const auto& [name, field_ptr] : s.cell_fields)
+                    w.set_cell_field(name, field_ptr);
+                return a(w);
+            }};
+            auto result = task.get_future();
+            {
+                std::lock_guard lock{_mutex};
+                _tasks.push_back(std::move(task));
+            }
+            _task_available.notify_one();
+            return result;
+        } catch (...) {
+            _release_slot();
+            throw;
+        }
+    }
+
+    Snapshot _make_snapshot() const {
+        Snapshot result;
+        const auto copy = [] (const auto& fields, auto& out) {
+            for (const auto& [name, field_ptr] : fields)
+                out.emplace_back(name, make_field_ptr(AsyncWriterDetail::SnapshotField{*field_ptr}));
+        };
+        copy(meta_data_fields(*this), result.meta_data);
+        copy(point_fields(*this), result.point_fields);
+        copy(cell_fields(*this), result.cell_fields);
+        return result;
+    }
+
+    void _work() {
+        while (true) {
+            std::unique_lock lock{_mutex};
+            _task_available.wait(lock, [&] () { return _stop || !_tasks.empty(); });
+            if (_tasks.empty())
+                return;
+
+            Task task = std::move(_tasks.front());
+            _tasks.pop_front();
+            lock.unlock();
+
+            task();
+            _release_slot();
+        }
+    }
+
+    void _release_slot() {
+        {
+            std::lock_guard lock{_mutex};
+            _pending--;
+        }
+        _slot_available.notify_all();
+    }
+
+    W _writer;
+    AsyncWriterOptions _opts;
+    std::deque<Task> _tasks;
+    std::size_t _pending = 0;
+    bool _stop = false;
+    mutable std::mutex _mutex;
+    mutable std::condition_variable _slot_available;
+    std::condition_variable _task_available;
+    std::thread _worker;
+};
+
+template<typename W>
+AsyncWriter(W&&, AsyncWriterOptions = {}) -> AsyncWriter<std::remove_cvref_t<W>>;
+
+//! \} group Grid
+
+}  // namespace GridFormat
+
+#endif  // GRIDFORMAT_GRID_ASYNC_WRITER_HPP_
@@ -22,6 +22,7 @@
 #include <gridformat/common/flat_index_mapper.hpp>
 #include <gridformat/common/ranges.hpp>
 #include <gridformat/common/field.hpp>
+#include <gridformat/common/threading.hpp>
 
 #include <gridformat/grid/_detail.hpp>
 #include <gridformat/grid/concepts.hpp>
@@ -29,6 +30,19 @@
 
 namespace GridFormat {
 
+/*!
+ * \ingroup Grid
+ * \brief Options for the evaluation of field functions on grid entities.
+ * \details If more than one thread is used, the entities are split into chunks of the given size,
+ *          which are evaluated concurrently. This requires the field function to be safe to be
+ *          called concurrently, and it is only done if the entity range of the grid is random-access.
+ *          Otherwise, the field function is evaluated on the calling thread.
+ */
+struct EntityFieldOptions {
+    std::size_t num_threads = 1;    //!< Number of threads used for the evaluation (0 = all available)
+    std::size_t chunk_size = 4096;  //!< Number of entities evaluated in one go by a thread
+};
+
 #ifndef DOXYGEN
 namespace EntityFieldsDetail {
 
@@ -54,6 +68,57 @@ namespace EntityFieldsDetail {
         });
     }
 
+    //! Invoke the action with the running index and each entity in the range [first, first + n),
+    //! possibly distributing chunks of entities over threads
+    template<std::ranges::range Entities, typename Action>
+    void for_each_entity(const Entities& entities,
+                         std::size_t first,
+                         std::size_t number_of_entities,
+                         const EntityFieldOptions& opts,
+                         const Action& action) {
+        if constexpr (std::ranges::random_access_range<const Entities>) {
+            const std::size_t chunk_size = std::max(opts.chunk_size, std::size_t{1});
+            const std::size_t number_of_chunks = number_of_entities/chunk_size + (number_of_entities%chunk_size > 0);
+            Threading::parallel_for(number_of_chunks, opts.num_threads, [&] (std::size_t chunk) {
+                const std::size_t begin = chunk*chunk_size;
+                const std::size_t end = std::min(begin + chunk_size, number_of_entities);
+                auto it = std::ranges::next(
+                    std::ranges::begin(entities),
+                    static_cast<std::ranges::range_difference_t<const Entities>>(first + begin)
+                );
+                for (std::size_t i = begin; i < end; ++i, ++it)
+                    action(i, *it);
+            });
+        } else {
+            auto it = std::ranges::next(
+                std::ranges::begin(entities),
+                static_cast<std::ranges::range_difference_t<const Entities>>(first),
+                std::ranges::end(entities)
+            );
+            for (std::size_t i = 0; i < number_of_entities; ++i, ++it)
+                action(i, *it);
+        }
+    }
+
+    //! Fill the values of the entities [first_entity, first_entity + n) into the given buffer
+    template<Concepts::Scalar ValueType,
+             typename Entities,
+             typename F>
+    void fill_unstructured(const Entities& entities,
+                           const F& field_function,
+                           const MDLayout& layout,
+                           const EntityFieldOptions& opts,
+                           std::size_t first_entity,
+                           std::span<std::byte> out) {
+        std::byte* buffer = out.data();
+        const auto bytes_per_entity = (layout.dimension() == 1 ? 1 : layout.sub_layout(1).number_of_entries())*sizeof(ValueType);
+        for_each_entity(entities, first_entity, out.size()/bytes_per_entity, opts, [&] (std::size_t i, const auto& e) {
+            std::size_t offset = i*bytes_per_entity;
+            fill_buffer<ValueType>(field_function(e), buffer, offset);
+        });
+    }
+
+    //! Fill the values of the entities with structured indices in [first_entity, first_entity + n) into the given buffer
     template<typename ValueType,
              typename Grid,
              typename Entities,
@@ -64,17 +129,19 @@ namespace EntityFieldsDetail {
                          const Extents& extents,
                          const F& field_function,
                          const MDLayout& layout,
-                         Serialization& serialization) {
-        auto values = serialization.as_span_of<ValueType>();
+                         const EntityFieldOptions& opts,
+                         std::size_t first_entity,
+                         std::span<std::byte> out) {
         const FlatIndexMapper index_mapper{extents};
         const auto values_offset = layout.dimension() == 1 ? 1 : layout.sub_layout(1).number_of_entries();
-        std::ranges::for_each(entities, [&] (const auto& e) {
-            const auto index = index_mapper.map(location(grid, e));
-            const auto cur_offset = index*values_offset;
-            auto cur_values = std::as_writable_bytes(values.subspan(cur_offset));
-
-            std::size_t offset = 0;
-            EntityFieldsDetail::fill_buffer<ValueType>(field_function(e), cur_values.data(), offset);
+        const std::size_t number_of_entities = out.size()/(values_offset*sizeof(ValueType));
+        for_each_entity(entities, 0, layout.extent(0), opts, [&] (std::size_t, const auto& e) {
+            const std::size_t index = index_mapper.map(location(grid, e));
+            if (index < first_entity || index >= first_entity + number_of_entities)
+                return;
+
+            std::size_t offset = (index - first_entity)*values_offset*sizeof(ValueType);
+            EntityFieldsDetail::fill_buffer<ValueType>(field_function(e), out.data(), offset);
         });
     }
 
@@ -85,12 +152,14 @@ namespace EntityFieldsDetail {
     void fill_structured(const Grid& grid,
                          const F& field_function,
                          const MDLayout& layout,
-                         Serialization& serialization) {
+                         const EntityFieldOptions& opts,
+                         std::size_t first_entity,
+                         std::span<std::byte> out) {
         if constexpr (Concepts::StructuredEntitySet<Grid>) {
             if constexpr (is_point_data)
-                fill_structured<ValueType>(grid, points(grid), point_extents(grid), field_function, layout, serialization);
+                fill_structured<ValueType>(grid, points(grid), point_extents(grid), field_function, layout, opts, first_entity, out);
             else
-                fill_structured<ValueType>(grid, cells(grid), extents(grid), field_function, layout, serialization);
+                fill_structured<ValueType>(grid, cells(grid), extents(grid), field_function, layout, opts, first_entity, out);
         } else {
             throw TypeError("Only structured grids can be used for entity fields with structured grid ordering");
         }
@@ -114,10 +183,12 @@ class PointField : public Field {
     explicit PointField(const Grid& grid,
                         FieldFunction&& field_function,
                         bool use_structured_grid_ordering,
-                        const Precision<ValueType>& = {})
+                        const Precision<ValueType>& = {},
+                        EntityFieldOptions opts = {})
     : _grid{grid}
     , _field_function{std::move(field_function)}
     , _write_structured{use_structured_grid_ordering}
+    , _opts{std::move(opts)}
     {}
 
  private:
@@ -140,25 +211,28 @@ class PointField : public Field {
     Serialization _serialized() const override {
         const auto layout = _layout();
         Serialization serialization(_size_in_bytes(layout));
-        _fill(serialization, layout);
+        _fill(layout, 0, serialization.as_span());
         return serialization;
     }
 
-    void _fill(Serialization& serialization, const MDLayout& layout) const {
+    void _serialize_bytes_into(std::size_t offset, std::span<std::byte> out) const override {
+        const auto layout = _layout();
+        const std::size_t bytes_per_entity = _size_in_bytes(layout)/layout.extent(0);
+        _fill(layout, offset/bytes_per_entity, out);
+    }
+
+    void _fill(const MDLayout& layout, std::size_t first_entity, std::span<std::byte> out) const {
         if (_write_structured) {
-            EntityFieldsDetail::fill_structured<true, ValueType>(_grid, _field_function, layout, serialization);
+            EntityFieldsDetail::fill_structured<true, ValueType>(_grid, _field_function, layout, _opts, first_entity, out);
         } else {
-            std::size_t offset = 0;
-            std::byte* buffer = serialization.as_span().data();
-            std::ranges::for_each(points(_grid), [&] (const auto& p) {
-                EntityFieldsDetail::fill_buffer<ValueType>(_field_function(p), buffer, offset);
-            });
+            EntityFieldsDetail::fill_unstructured<ValueType>(points(_grid), _field_function, layout, _opts, first_entity, out);
         }
     }
 
     const Grid& _grid;
     FieldFunction _field_function;
     bool _write_structured;
+    EntityFieldOptions _opts;
 };
 
 /*!
@@ -175,10 +249,12 @@ class CellField : public Field {
     explicit CellField(const Grid& grid,
                        FieldFunction&& field_function,
                        bool use_structured_grid_ordering,
-                       const Precision<ValueType>& = {})
+                       const Precision<ValueType>& = {},
+                       EntityFieldOptions opts = {})
     : _grid{grid}
     , _field_function{std::move(field_function)}
     , _write_structured{use_structured_grid_ordering}
+    , _opts{std::move(opts)}
     {}
 
  private:
@@ -201,25 +277,28 @@ class CellField : public Field {
     Serialization _serialized() const override {
         const auto layout = _layout();
         Serialization serialization(_size_in_bytes(layout));
-        _fill(serialization, layout);
+        _fill(layout, 0, serialization.as_span());
         return serialization;
     }
 
-    void _fill(Serialization& serialization, const MDLayout& layout) const {
+    void _serialize_bytes_into(std::size_t offset, std::span<std::byte> out) const override {
+        const auto layout = _layout();
+        const std::size_t bytes_per_entity = _size_in_bytes(layout)/layout.extent(0);
+        _fill(layout, offset/bytes_per_entity, out);
+    }
+
+    void _fill(const MDLayout& layout, std::size_t first_entity, std::span<std::byte> out) const {
         if (_write_structured) {
-            EntityFieldsDetail::fill_structured<false, ValueType>(_grid, _field_function, layout, serialization);
+            EntityFieldsDetail::fill_structured<false, ValueType>(_grid, _field_function, layout, _opts, first_entity, out);
         } else {
-            std::size_t offset = 0;
-            std::byte* buffer = serialization.as_span().data();
-            std::ranges::for_each(cells(_grid), [&] (const auto& c) {
-                EntityFieldsDetail::fill_buffer<ValueType>(_field_function(c), buffer, offset);
-            });
+            EntityFieldsDetail::fill_unstructured<ValueType>(cells(_grid), _field_function, layout, _opts, first_entity, out);
         }
     }
 
     const Grid& _grid;
     FieldFunction _field_function;
     bool _write_structured;
+    EntityFieldOptions _opts;
 };
 
 }  // namespace GridFormat
@@ -12,9 +12,13 @@
 #include <concepts>
 #include <cassert>
 #include <numeric>
+#include <limits>
+#include <string>
+#include <vector>
 #include <algorithm>
 #include <unordered_map>
 
+#include <gridformat/common/exceptions.hpp>
 #include <gridformat/common/ranges.hpp>
 #include <gridformat/common/concepts.hpp>
 #include <gridformat/common/flat_index_mapper.hpp>
@@ -156,15 +160,97 @@ Concepts::StaticallySizedRange decltype(auto) location(const Grid& grid, const P
     return Traits::Location<Grid, Point<Grid>>::get(grid, p);
 }
 
-template<GridDetail::ExposesPointRange Grid> requires(GridDetail::ExposesPointId<Grid>)
-std::unordered_map<std::size_t, std::size_t> make_point_id_map(const Grid& grid) {
-    std::size_t i = 0;
-    std::unordered_map<std::size_t, std::size_t> point_id_to_running_idx;
-    for (const auto& p : points(grid)) {
-        assert(id(grid, p) >= 0);
-        point_id_to_running_idx[id(grid, p)] = i++;
+/*!
+ * \brief Maps the ids of the points of a grid to their running index in the point range.
+ * \details Upon construction, the range of point ids is inspected. If the ids coincide with
+ *          the running indices, no storage is used at all. If the ids are dense, i.e. the largest
+ *          id is not much larger than the number of points, the map is stored in a flat vector
+ *          indexed by the ids. Otherwise, a hash map is used.
+ */
+class PointIdMap {
+    static constexpr std::size_t invalid_index = std::numeric_limits<std::size_t>::max();
+    static constexpr std::size_t max_dense_overhead = 4;  // max ratio of the id range to the number of points
+
+ public:
+    enum class Storage { identity, dense, sparse };
+
+    template<GridDetail::ExposesPointRange Grid> requires(GridDetail::ExposesPointId<Grid>)
+    explicit PointIdMap(const Grid& grid) {
+        std::size_t max_id = 0;
+        bool is_identity = true;
+        for (const auto& p : points(grid)) {
+            assert(id(grid, p) >= 0);
+            const auto point_id = static_cast<std::size_t>(id(grid, p));
+            is_identity = is_identity && point_id == _size;
+            max_id = std::max(max_id, point_id);
+            _size++;
+        }
+
+        if (is_identity)
+            _storage = Storage::identity;
+        else if (max_id/max_dense_overhead < std::max(_size, std::size_t{1}))
+            _fill_dense(grid, max_id);
+        else
+            _fill_sparse(grid);
+    }
+
+    //! Return the running index of the point with the given id
+    std::size_t at(std::size_t point_id) const {
+        switch (_storage) {
+            case Storage::identity:
+                if (point_id < _size)
+                    return point_id;
+                break;
+            case Storage::dense:
+                if (point_id < _dense.size() && _dense[point_id] != invalid_index)
+                    return _dense[point_id];
+                break;
+            case Storage::sparse:
+                if (auto it = _sparse.find(point_id); it != _sparse.end())
+                    return it->second;
+                break;
+        }
+        throw ValueError("Unknown point id: " + std::to_string(point_id));
+    }
+
+    //! Return the number of points of the grid this map was constructed from
+    std::size_t size() const {
+        return _size;
     }
-    return point_id_to_running_idx;
+
+    //! Return the storage chosen for the map
+    Storage storage() const {
+        return _storage;
+    }
+
+ private:
+    template<typename Grid>
+    void _fill_dense(const Grid& grid, std::size_t max_id) {
+        _storage = Storage::dense;
+        _dense.resize(max_id + 1, invalid_index);
+        std::size_t i = 0;
+        for (const auto& p : points(grid))
+            _dense[static_cast<std::size_t>(id(grid, p))] = i++;
+    }
+
+    template<typename Grid>
+    void _fill_sparse(const Grid& grid) {
+        _storage = Storage::sparse;
+        _sparse.reserve(_size);
+        std::size_t i = 0;
+        for (const auto& p : points(grid))
+            _sparse[static_cast<std::size_t>(id(grid, p))] = i++;
+    }
+
+    Storage _storage = Storage::identity;
+    std::size_t _size = 0;
+    std::vector<std::size_t> _dense;
+    std::unordered_map<std::size_t, std::size_t> _sparse;
+};
+
+template<GridDetail::ExposesPointRange Grid> requires(GridDetail::ExposesPointId<Grid>)
+PointIdMap make_point_id_map(const Grid& grid) {
+    return PointIdMap{grid};
 }
 
 //! \} group Grid
@@ -159,6 +159,15 @@ class GridWriterBase {
         _ignore_warnings = value;
     }
 
+    //! Set the options for evaluating point/cell functions (affects fields set after this call)
+    void set_entity_field_options(EntityFieldOptions opts) {
+        _entity_field_opts = std::move(opts);
+    }
+
+    const EntityFieldOptions& entity_field_options() const {
+        return _entity_field_opts;
+    }
+
     const Grid& grid() const {
         return _grid;
     }
@@ -242,15 +251,15 @@ class GridWriterBase {
     template<typename EntityFunction, Concepts::Scalar T>
     auto _make_point_field(EntityFunction&& f, const Precision<T>& prec) const {
         if (_opts.has_value())
-            return PointField{_grid, std::move(f), _opts.value().use_structured_grid_ordering, prec};
-        return PointField{_grid, std::move(f), false, prec};
+            return PointField{_grid, std::move(f), _opts.value().use_structured_grid_ordering, prec, _entity_field_opts};
+        return PointField{_grid, std::move(f), false, prec, _entity_field_opts};
     }
 
     template<typename EntityFunction, Concepts::Scalar T>
     auto _make_cell_field(EntityFunction&& f, const Precision<T>& prec) const {
         if (_opts.has_value())
-            return CellField{_grid, std::move(f), _opts.value().use_structured_grid_ordering, prec};
-        return CellField{_grid, std::move(f), false, prec};
+            return CellField{_grid, std::move(f), _opts.value().use_structured_grid_ordering, prec, _entity_field_opts};
+        return CellField{_grid, std::move(f), false, prec, _entity_field_opts};
     }
 
     std::ranges::range auto _point_field_names() const {
@@ -295,6 +304,7 @@ class GridWriterBase {
     FieldStorage _cell_fields;
     FieldStorage _meta_data;
     std::optional<WriterOptions> _opts;
+    EntityFieldOptions _entity_field_opts = {};
     bool _ignore_warnings = false;
 };
 
@@ -22,6 +22,7 @@
 #include <gridformat/writer.hpp>
 
 #include <gridformat/grid/converter.hpp>
+#include <gridformat/grid/async_writer.hpp>
 #include <gridformat/grid/image_grid.hpp>
 
 #include <gridformat/common/exceptions.hpp>
@@ -192,6 +193,20 @@ struct VTKXMLFormatBase : public FormatWithOptions<VTKFormat, VTK::XMLOptions> {
         Variant::unwrap_to(cur_opts.compressor, c);
         return this->with(std::move(cur_opts));
     }
+
+    //! Construct a new instance of this format with modified number of threads for preparing data arrays
+    constexpr auto with_threads(std::size_t num_threads) const {
+        auto cur_opts = this->opts.value_or(VTK::XMLOptions{});
+        cur_opts.num_threads = num_threads;
+        return this->with(std::move(cur_opts));
+    }
+
+    //! Construct a new instance of this format that encodes the grid arrays only once (for time series on static grids)
+    constexpr auto with_static_grid(bool value = true) const {
+        auto cur_opts = this->opts.value_or(VTK::XMLOptions{});
+        cur_opts.static_grid = value;
+        return this->with(std::move(cur_opts));
+    }
 };
 
 
@@ -0,0 +1,111 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+/*!
+ * \file
+ * \ingroup Parallel
+ * \copydoc GridFormat::Parallel::Aggregation
+ */
+#ifndef GRIDFORMAT_PARALLEL_AGGREGATION_HPP_
+#define GRIDFORMAT_PARALLEL_AGGREGATION_HPP_
+
+#include <ranges>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+
+#include <gridformat/common/exceptions.hpp>
+#include <gridformat/parallel/concepts.hpp>
+#include <gridformat/parallel/communication.hpp>
+
+namespace GridFormat::Parallel {
+
+//! \addtogroup Parallel
+//! \{
+
+/*!
+ * \brief Partitions the processes of a communicator into groups of consecutive ranks, whose
+ *        data is collected by the first process of each group (the aggregator).
+ * \details This allows a subset of the processes to perform I/O on behalf of their group, e.g.
+ *          one process per compute node if the group size is chosen as the number of ranks per node.
+ *          The other processes only send their data to their aggregator and may return afterwards.
+ */
+template<Concepts::PointToPointCommunicator Communicator>
+class Aggregation {
+ public:
+    explicit Aggregation(const Communicator& comm, std::size_t ranks_per_aggregator)
+    : _comm{comm}
+    , _rank{Parallel::rank(comm)}
+    , _size{Parallel::size(comm)}
+    , _group_size{static_cast<int>(ranks_per_aggregator)} {
+        if (ranks_per_aggregator == 0)
+            throw ValueError("Number of ranks per aggregator must be positive");
+    }
+
+    //! Return the underlying communicator
+    const Communicator& communicator() const {
+        return _comm;
+    }
+
+    //! Return the rank of the aggregator of the group this process belongs to
+    int aggregator() const {
+        return _rank - _rank%_group_size;
+    }
+
+    //! Return true if this process is an aggregator
+    bool is_aggregator() const {
+        return aggregator() == _rank;
+    }
+
+    //! Return the ranks of all processes in the group of this process (starting with the aggregator)
+    std::ranges::view auto group() const {
+        return std::views::iota(aggregator(), std::min(aggregator() + _group_size, _size));
+    }
+
+    //! Return the ranks of all aggregators
+    std::ranges::view auto aggregators() const {
+        return std::views::iota(0, number_of_groups())
+            | std::views::transform([g=_group_size] (int i) { return i*g; });
+    }
+
+    //! Return the number of groups (i.e. the number of aggregators)
+    int number_of_groups() const {
+        return _size/_group_size + (_size%_group_size ? 1 : 0);
+    }
+
+    /*!
+     * \brief Gather the given values of all processes in the group on the aggregator.
+     * \details The aggregator receives the concatenation of the values in the order of the ranks,
+     *          while the other processes send their values and receive an empty vector.
+     */
+    template<std::ranges::contiguous_range R> requires(std::ranges::sized_range<R>)
+    auto gather(const R& values) const {
+        using T = std::remove_cvref_t<std::ranges::range_value_t<R>>;
+        std::vector<T> result;
+        if (!is_aggregator()) {
+            Parallel::send(_comm, values, aggregator());
+            return result;
+        }
+
+        result.reserve(std::ranges::size(values));
+        std::ranges::copy(values, std::back_inserter(result));
+        std::ranges::for_each(group() | std::views::drop(1), [&] (int rank) {
+            const auto received = Parallel::receive<T>(_comm, rank);
+            result.insert(result.end(), received.begin(), received.end());
+        });
+        return result;
+    }
+
+ private:
+    Communicator _comm;
+    int _rank;
+    int _size;
+    int _group_size;
+};
+
+//! \} group Parallel
+
+}  // namespace GridFormat::Parallel
+
+#endif  // GRIDFORMAT_PARALLEL_AGGREGATION_HPP_
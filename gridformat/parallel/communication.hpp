@@ -8,6 +8,8 @@
 #ifndef GRIDFORMAT_PARALLEL_COMMUNICATION_HPP_
 #define GRIDFORMAT_PARALLEL_COMMUNICATION_HPP_
 
+#include <vector>
+
 #include <gridformat/parallel/traits.hpp>
 #include <gridformat/parallel/concepts.hpp>
 
@@ -70,6 +72,18 @@ inline auto scatter(const C& comm, const T& values, int root = 0) {
     return ParallelTraits::Scatter<C>::get(comm, values, root);
 }
 
+//! Send values to the process with the given rank
+template<Concepts::PointToPointCommunicator C, typename T>
+inline void send(const C& comm, const T& values, int target) {
+    ParallelTraits::Send<C>::get(comm, values, target);
+}
+
+//! Receive the values sent by the process with the given rank
+template<typename T, Concepts::PointToPointCommunicator C>
+inline std::vector<T> receive(const C& comm, int source) {
+    return ParallelTraits::Receive<C>::template get<T>(comm, source);
+}
+
 //! \} group Parallel
 
 }  // namespace GridFormat::Parallel
@@ -77,6 +77,15 @@ concept ScatterCommunicator = is_complete<ParallelTraits::Scatter<T>> && require
     { ParallelTraits::Scatter<T>::get(t, std::array<double, 2>{}) } -> RangeOf<double>;
 };
 
+template<typename T>
+concept PointToPointCommunicator
+    = is_complete<ParallelTraits::Send<T>>
+    and is_complete<ParallelTraits::Receive<T>>
+    and requires(const T& t) {
+        { ParallelTraits::Send<T>::get(t, std::array<int, 2>{}, int{}) };
+        { ParallelTraits::Receive<T>::template get<int>(t, int{}) } -> RangeOf<int>;
+    };
+
 //! \} group Concepts
 
 }  // namespace GridFormat::Concepts
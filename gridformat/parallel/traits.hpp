@@ -62,6 +62,14 @@ struct Gather;
 template<typename Communicator>
 struct Scatter;
 
+//! Metafunction to send values to another process via a static function `void get(const Communicator&, const R& values, int target_rank)`
+template<typename Communicator>
+struct Send;
+
+//! Metafunction to receive the values sent by another process via a static function `std::vector<T> get<T>(const Communicator&, int source_rank)`
+template<typename Communicator>
+struct Receive;
+
 //! \} group Parallel
 
 }  // namespace GridFormat::ParallelTraits
@@ -165,6 +173,22 @@ struct Scatter<NullCommunicator> {
     }
 };
 
+template<>
+struct Send<NullCommunicator> {
+    template<std::ranges::range R>
+    static void get(const NullCommunicator&, const R&, [[maybe_unused]] int target_rank) {
+        throw InvalidState("Null communicator has no other processes to send values to");
+    }
+};
+
+template<>
+struct Receive<NullCommunicator> {
+    template<typename T>
+    static std::vector<T> get(const NullCommunicator&, [[maybe_unused]] int source_rank) {
+        throw InvalidState("Null communicator has no other processes to receive values from");
+    }
+};
+
 }  // namespace ParallelTraits
 
 }  // namespace GridFormat
@@ -173,6 +197,8 @@ struct Scatter<NullCommunicator> {
 
 #include <mpi.h>
 
+#include <cstddef>
+
 #include <gridformat/common/exceptions.hpp>
 
 namespace GridFormat::ParallelTraits {
@@ -180,9 +206,14 @@ namespace GridFormat::ParallelTraits {
 #ifndef DOXYGEN
 namespace MPIDetail {
 
+// tag used for point-to-point communication
+inline constexpr int point_to_point_tag = 4711;
+
 template<typename T>
 decltype(auto) get_data_type() {
-    if constexpr (std::is_same_v<T, char>)
+    if constexpr (std::is_same_v<T, std::byte>)
+        return MPI_BYTE;
+    else if constexpr (std::is_same_v<T, char>)
         return MPI_CHAR;
     else if constexpr (std::is_same_v<T, signed short int>)
         return MPI_SHORT;
@@ -441,6 +472,45 @@ struct Scatter<MPI_Comm> {
     }
 };
 
+template<>
+struct Send<MPI_Comm> {
+    template<std::ranges::contiguous_range R> requires(std::ranges::sized_range<R>)
+    static void get(MPI_Comm comm, const R& values, int target_rank) {
+        using T = std::remove_cvref_t<std::ranges::range_value_t<R>>;
+        MPI_Send(
+            std::ranges::cdata(values),
+            static_cast<int>(std::ranges::size(values)),
+            MPIDetail::get_data_type<T>(),
+            target_rank,
+            MPIDetail::point_to_point_tag,
+            comm
+        );
+    }
+};
+
+template<>
+struct Receive<MPI_Comm> {
+    template<typename T>
+    static std::vector<T> get(MPI_Comm comm, int source_rank) {
+        MPI_Status status;
+        MPI_Probe(source_rank, MPIDetail::point_to_point_tag, comm, &status);
+
+        int num_values;
+        MPI_Get_count(&status, MPIDetail::get_data_type<T>(), &num_values);
+        std::vector<T> result(num_values);
+        MPI_Recv(
+            result.data(),
+            num_values,
+            MPIDetail::get_data_type<T>(),
+            source_rank,
+            MPIDetail::point_to_point_tag,
+            comm,
+            MPI_STATUS_IGNORE
+        );
+        return result;
+    }
+};
+
 }  // namespace GridFormat::ParallelTraits
 
 #endif  // GRIDFORMAT_HAVE_MPI
@@ -85,8 +85,9 @@ class Appendix {
     };
 
  public:
-    template<typename... Args>
-    void add(DataArray<Args...>&& data_array) {
+    template<Concepts::StreamableWith<std::ostream> DA>
+        requires(!std::is_lvalue_reference_v<DA>)
+    void add(DA&& data_array) {
         _emplace_back(DataArrayImpl{std::move(data_array)});
     }
 
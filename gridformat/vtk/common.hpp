@@ -15,6 +15,10 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <vector>
+#include <span>
+#include <cstddef>
+#include <iterator>
 
 #include <gridformat/common/field.hpp>
 #include <gridformat/common/concepts.hpp>
@@ -145,6 +149,47 @@ auto make_coordinates_field(const Grid& grid, bool structured_grid_ordering) {
     });
 }
 
+namespace CommonDetail {
+
+    // Stores the number of corners preceding every n-th cell, such that the cells
+    // belonging to a range of connectivity/offset entries can be located quickly.
+    class CellCornerCheckpoints {
+        static constexpr std::size_t stride = 1024;
+
+     public:
+        template<typename Grid, std::ranges::range Cells>
+        CellCornerCheckpoints(const Grid& grid, const Cells& cells) {
+            std::ranges::for_each(cells, [&] (const auto& cell) {
+                if (_num_cells%stride == 0)
+                    _corner_offsets.push_back(_num_corners);
+                _num_corners += number_of_points(grid, cell);
+                _num_cells++;
+            });
+        }
+
+        std::size_t number_of_cells() const { return _num_cells; }
+        std::size_t number_of_corners() const { return _num_corners; }
+
+        //! Return the index and corner offset of a cell at or before the cell with the given corner
+        std::pair<std::size_t, std::size_t> cell_before_corner(std::size_t corner) const {
+            const auto it = std::ranges::upper_bound(_corner_offsets, corner);
+            const auto i = static_cast<std::size_t>(std::distance(_corner_offsets.begin(), it)) - 1;
+            return {i*stride, _corner_offsets[i]};
+        }
+
+        //! Return the index and corner offset of a cell at or before the given cell
+        std::pair<std::size_t, std::size_t> cell_before(std::size_t cell) const {
+            return {(cell/stride)*stride, _corner_offsets[cell/stride]};
+        }
+
+     private:
+        std::vector<std::size_t> _corner_offsets;
+        std::size_t _num_cells = 0;
+        std::size_t _num_corners = 0;
+    };
+
+}  // namespace CommonDetail
+
 template<typename HeaderType = std::size_t,
          Concepts::UnstructuredGrid Grid,
          std::ranges::forward_range Cells,
@@ -160,34 +205,47 @@ auto make_connectivity_field(const Grid& grid,
                                    PointMap&& map)
         : _grid(g)
         , _cells{std::forward<Cells>(cells)}
-        , _point_map{std::forward<PointMap>(map)} {
-            _num_values = 0;
-            std::ranges::for_each(_cells, [&] (const auto& cell) {
-                _num_values += number_of_points(_grid, cell);
-            });
-        }
+        , _point_map{std::forward<PointMap>(map)}
+        , _checkpoints{_grid, _cells}
+        {}
 
      private:
-        MDLayout _layout() const override { return MDLayout{{_num_values}}; }
+        MDLayout _layout() const override { return MDLayout{{_checkpoints.number_of_corners()}}; }
         DynamicPrecision _precision() const override { return Precision<HeaderType>{}; }
         Serialization _serialized() const override {
-            Serialization serialization(sizeof(HeaderType)*_num_values);
-            HeaderType* data = serialization.as_span_of<HeaderType>().data();
-
-            std::size_t i = 0;
-            std::ranges::for_each(_cells, [&] (const auto& cell) {
-                std::ranges::for_each(points(_grid, cell), [&] (const auto& point) {
-                    data[i] = _point_map.at(id(_grid, point));
-                    i++;
-                });
-            });
+            Serialization serialization(sizeof(HeaderType)*_checkpoints.number_of_corners());
+            if (serialization.size() > 0)
+                _serialize_bytes_into(0, serialization.as_span());
             return serialization;
         }
 
+        // only visits the cells whose corners lie in the requested range
+        void _serialize_bytes_into(std::size_t offset, std::span<std::byte> out) const override {
+            HeaderType* data = reinterpret_cast<HeaderType*>(out.data());
+            const std::size_t first = offset/sizeof(HeaderType);
+            const std::size_t count = out.size()/sizeof(HeaderType);
+
+            const auto [cell_index, cell_corner] = _checkpoints.cell_before_corner(first);
+            std::size_t corner = cell_corner;
+            auto cell_it = std::ranges::next(std::ranges::begin(_cells), cell_index);
+            for (std::size_t i = 0; i < count; ++cell_it) {
+                const std::size_t num_cell_corners = number_of_points(_grid, *cell_it);
+                if (corner + num_cell_corners <= first) {
+                    corner += num_cell_corners;
+                    continue;
+                }
+                std::ranges::for_each(points(_grid, *cell_it), [&] (const auto& point) {
+                    if (corner >= first && i < count)
+                        data[i++] = static_cast<HeaderType>(_point_map.at(id(_grid, point)));
+                    corner++;
+                });
+            }
+        }
+
         const Grid& _grid;
         LVReferenceOrValue<Cells> _cells;
         LVReferenceOrValue<PointMap> _point_map;
-        HeaderType _num_values;
+        CommonDetail::CellCornerCheckpoints _checkpoints;
     } _field{grid, std::forward<Cells>(cells), std::forward<PointMap>(map)};
 
     return make_vtk_field(std::move(_field));
@@ -209,29 +267,38 @@ auto make_offsets_field(const Grid& grid, Cells&& cells) {
         explicit OffsetField(const Grid& g, Cells&& cells)
         : _grid(g)
         , _cells{std::forward<Cells>(cells)}
-        , _num_cells{static_cast<HeaderType>(Ranges::size(_cells))}
+        , _checkpoints{_grid, _cells}
         {}
 
      private:
-        MDLayout _layout() const override { return MDLayout{{_num_cells}}; }
+        MDLayout _layout() const override { return MDLayout{{_checkpoints.number_of_cells()}}; }
         DynamicPrecision _precision() const override { return Precision<HeaderType>{}; }
         Serialization _serialized() const override {
-            Serialization serialization(sizeof(HeaderType)*_num_cells);
-            HeaderType* data = serialization.as_span_of<HeaderType>().data();
-
-            std::size_t i = 0;
-            HeaderType offset = 0;
-            std::ranges::for_each(_cells, [&] (const auto& cell) {
-                offset += number_of_points(_grid, cell);
-                data[i] = offset;
-                i++;
-            });
+            Serialization serialization(sizeof(HeaderType)*_checkpoints.number_of_cells());
+            if (serialization.size() > 0)
+                _serialize_bytes_into(0, serialization.as_span());
             return serialization;
         }
 
+        // only visits the cells in the requested range (and those since the preceding checkpoint)
+        void _serialize_bytes_into(std::size_t offset, std::span<std::byte> out) const override {
+            HeaderType* data = reinterpret_cast<HeaderType*>(out.data());
+            const std::size_t first = offset/sizeof(HeaderType);
+            const std::size_t count = out.size()/sizeof(HeaderType);
+
+            auto [cell_index, corner] = _checkpoints.cell_before(first);
+            auto cell_it = std::ranges::next(std::ranges::begin(_cells), cell_index);
+            for (; cell_index < first; ++cell_index, ++cell_it)
+                corner += number_of_points(_grid, *cell_it);
+            for (std::size_t i = 0; i < count; ++i, ++cell_it) {
+                corner += number_of_points(_grid, *cell_it);
+                data[i] = static_cast<HeaderType>(corner);
+            }
+        }
+
         const Grid& _grid;
         LVReferenceOrValue<Cells> _cells;
-        HeaderType _num_cells;
+        CommonDetail::CellCornerCheckpoints _checkpoints;
     } _field{grid, std::forward<Cells>(cells)};
 
     return make_vtk_field(std::move(_field));
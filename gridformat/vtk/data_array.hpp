@@ -9,15 +9,19 @@
 #define GRIDFORMAT_VTK_DATA_ARRAY_HPP_
 
 #include <span>
+#include <array>
+#include <cstddef>
 #include <utility>
 #include <ostream>
 #include <vector>
 #include <iterator>
+#include <algorithm>
 #include <type_traits>
 
 #include <gridformat/encoding/ascii.hpp>
 #include <gridformat/encoding/concepts.hpp>
 #include <gridformat/encoding/encoded_field.hpp>
+#include <gridformat/compression/common.hpp>
 #include <gridformat/compression/concepts.hpp>
 
 namespace GridFormat::VTK {
@@ -33,6 +37,7 @@ template<typename Encoder,
          typename HeaderType>
 class DataArray {
     static constexpr bool do_compression = !std::is_same_v<Compressor, None>;
+    static constexpr std::size_t chunk_size_in_bytes = std::size_t{3} << 20;  // multiple of 3 for base64 encoding
 
  public:
     DataArray(const Field& field,
@@ -44,11 +49,13 @@ class DataArray {
     , _compressor{std::move(compressor)} {
         // if no ascii formatting was specified by the user, set our defaults
         if constexpr (std::is_same_v<Encoder, GridFormat::Encoding::Ascii>) {
-            if (_encoder.options() == GridFormat::AsciiFormatOptions{})
+            const auto num_threads = _encoder.options().num_threads;
+            if (_encoder.options() == GridFormat::AsciiFormatOptions{.num_threads = num_threads})
                 _encoder = _encoder.with({
                     .delimiter = " ",
                     .line_prefix = std::string(10, ' '),
-                    .entries_per_line = 15
+                    .entries_per_line = 15,
+                    .num_threads = num_threads
                 });
         }
     }
@@ -77,24 +84,120 @@ class DataArray {
         auto encoded = _encoder(s);
         std::array<const HeaderType, 1> number_of_bytes{static_cast<HeaderType>(_field.size_in_bytes())};
         encoded.write(std::span{number_of_bytes});
-        s << EncodedField{_field, _encoder};
+        if (const auto bytes = _field.contiguous_bytes()) {
+            encoded.write(*bytes);
+            return;
+        }
+
+        // stream the values of non-contiguous fields in chunks to avoid serializing them as a whole
+        // (the chunk size is a multiple of three such that base64 output is not padded in between)
+        Serialization chunk{std::min(chunk_size_in_bytes, _field.size_in_bytes())};
+        for (std::size_t offset = 0; offset < _field.size_in_bytes(); offset += chunk.size()) {
+            const auto out = chunk.as_span().first(std::min(chunk.size(), _field.size_in_bytes() - offset));
+            _field.serialize_bytes_into(offset, out);
+            encoded.write(out);
+        }
     }
 
     void _export_compressed_binary(std::ostream& s) const requires(Concepts::Compressor<Compressor>) {
-        _field.precision().visit([&] <typename T> (const Precision<T>&) {
-            auto encoded = _encoder(s);
-            Serialization serialization = _field.serialized();
-            const auto blocks = _compressor.template compress<HeaderType>(serialization);
-
-            std::vector<HeaderType> header;
-            header.reserve(blocks.compressed_block_sizes.size() + 3);
-            header.push_back(blocks.number_of_blocks);
-            header.push_back(blocks.block_size);
-            header.push_back(blocks.residual_block_size);
-            std::ranges::copy(blocks.compressed_block_sizes, std::back_inserter(header));
-            encoded.write(std::span{header});
-            encoded.write(serialization.as_span());
-        });
+        if constexpr (Concepts::BlockwiseCompressor<Compressor>)
+            if (s.tellp() != std::ostream::pos_type(-1))
+                return _export_compressed_binary_pipelined(s);
+
+        auto encoded = _encoder(s);
+        if constexpr (requires { _compressor.template compress<HeaderType>(std::span<const std::byte>{}); }) {
+            if (const auto bytes = _field.contiguous_bytes()) {  // compress without copying the field data
+                const auto [blocks, compressed] = _compressor.template compress<HeaderType>(*bytes);
+                const auto header = _make_header(blocks);
+                encoded.write(std::span{header});
+                encoded.write(compressed.as_span());
+                return;
+            }
+        }
+
+        Serialization serialization = _field.serialized();
+        const auto blocks = _compressor.template compress<HeaderType>(serialization);
+        const auto header = _make_header(blocks);
+        encoded.write(std::span{header});
+        encoded.write(serialization.as_span());
+    }
+
+    // Compresses and encodes the data block by block, such that the compressed data is never
+    // held in memory as a whole. Since the compressed block sizes are only known at the end,
+    // a placeholder header is written first, which is overwritten afterwards (requires a seekable stream).
+    void _export_compressed_binary_pipelined(std::ostream& s) const requires(Concepts::BlockwiseCompressor<Compressor>) {
+        auto encoded = _encoder(s);
+        const std::size_t size_in_bytes = _field.size_in_bytes();
+        const std::size_t block_size = _compressor.options().block_size;
+        const Compression::Blocks<HeaderType> blocks{
+            static_cast<HeaderType>(size_in_bytes),
+            static_cast<HeaderType>(block_size)
+        };
+
+        const auto header_pos = s.tellp();
+        const std::vector<HeaderType> placeholder_header(blocks.number_of_blocks + 3, HeaderType{0});
+        encoded.write(std::span{placeholder_header});
+
+        // write the data in chunks that are multiples of three bytes such that the
+        // encoding (e.g. base64) yields the same result as if it was written at once
+        std::array<std::byte, 3> carry;
+        std::size_t carry_size = 0;
+        const auto write_block = [&] (std::span<const std::byte> block) {
+            while (carry_size > 0 && carry_size < carry.size() && !block.empty()) {
+                carry[carry_size++] = block.front();
+                block = block.subspan(1);
+            }
+            if (carry_size == carry.size()) {
+                encoded.write(std::span{carry});
+                carry_size = 0;
+            }
+            const std::size_t num_remaining = block.size()%carry.size();
+            encoded.write(block.first(block.size() - num_remaining));
+            std::ranges::copy(block.last(num_remaining), carry.begin());
+            carry_size += num_remaining;
+        };
+
+        // non-contiguous fields are serialized and compressed in chunks of full blocks, such that
+        // the result is the same as if the entire field had been compressed in one go
+        std::vector<HeaderType> compressed_block_sizes;
+        compressed_block_sizes.reserve(blocks.number_of_blocks);
+        const auto compress = [&] (std::span<const std::byte> data) {
+            const auto compressed = _compressor.template compress_blockwise<HeaderType>(data, write_block);
+            std::ranges::copy(compressed.compressed_block_sizes, std::back_inserter(compressed_block_sizes));
+        };
+
+        if (const auto bytes = _field.contiguous_bytes())
+            compress(*bytes);
+        else {
+            Serialization chunk{std::min(
+                std::max(chunk_size_in_bytes/block_size, std::size_t{1})*block_size,
+                size_in_bytes
+            )};
+            for (std::size_t offset = 0; offset < size_in_bytes; offset += chunk.size()) {
+                const auto data = chunk.as_span().first(std::min(chunk.size(), size_in_bytes - offset));
+                _field.serialize_bytes_into(offset, data);
+                compress(data);
+            }
+        }
+        const Compression::CompressedBlocks<HeaderType> compressed_blocks{blocks, std::move(compressed_block_sizes)};
+        if (carry_size > 0)
+            encoded.write(std::span{carry}.first(carry_size));
+
+        const auto end_pos = s.tellp();
+        const auto header = _make_header(compressed_blocks);
+        s.seekp(header_pos);
+        encoded.write(std::span{header});
+        s.seekp(end_pos);
+    }
+
+    std::vector<HeaderType> _make_header(const Compression::CompressedBlocks<HeaderType>& blocks) const {
+        std::vector<HeaderType> header;
+        header.reserve(blocks.compressed_block_sizes.size() + 3);
+        header.push_back(blocks.number_of_blocks);
+        header.push_back(blocks.block_size);
+        header.push_back(blocks.residual_block_size);
+        std::ranges::copy(blocks.compressed_block_sizes, std::back_inserter(header));
+        return header;
     }
 
     const Field& _field;
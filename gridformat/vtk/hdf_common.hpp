@@ -22,10 +22,21 @@ namespace GridFormat {
 
 namespace VTK {
 
+//! Controls how the chunks of the appended datasets of transient vtk-hdf files grow with the time steps
+enum class HDFChunkGrowth {
+    across_steps,  //!< chunks may span the data of several time steps to reach the target chunk size
+    per_step       //!< chunks do not exceed the extent of the data of the first time step
+};
+
 //! Options for transient vtk-hdf file formats
 struct HDFTransientOptions {
     bool static_grid = false; //!< Set to true the grid is the same for all time steps (will only be written once)
     bool static_meta_data = true; //!< Set to true if the metadata is same for all time steps (will only be written once)
+    std::size_t chunk_size_in_bytes = 0; //!< Target size of the chunks of appended datasets (0 = default of the dataset options)
+    HDFChunkGrowth chunk_growth = HDFChunkGrowth::across_steps; //!< Growth policy for the chunks of appended datasets
+    std::size_t chunk_cache_size_in_bytes = 0; //!< Size of the raw data chunk cache per dataset (0 = HDF5 default)
+    bool keep_file_open = false; //!< Set to true to keep the file open between time steps (until the writer is destroyed)
+    std::size_t flush_interval = 1; //!< Flush the open file every n-th time step (0 = only when it is closed)
 };
 
 }  // namespace VTK
@@ -126,6 +137,17 @@ DataSetField(const HDF5::File<C>&, std::string) -> DataSetField<C>;
 template<typename C, typename CB>
 DataSetField(const HDF5::File<C>&, MDLayout, DynamicPrecision, CB&&) -> DataSetField<C>;
 
+//! Return the given dataset options with the chunking and caching settings of the transient options applied
+inline HDF5::DataSetOptions with_transient_options(HDF5::DataSetOptions opts,
+                                                   const VTK::HDFTransientOptions& transient_opts) {
+    if (transient_opts.chunk_size_in_bytes > 0)
+        opts.chunk_size_in_bytes = transient_opts.chunk_size_in_bytes;
+    if (transient_opts.chunk_cache_size_in_bytes > 0)
+        opts.chunk_cache_size_in_bytes = transient_opts.chunk_cache_size_in_bytes;
+    opts.chunks_span_appends = transient_opts.chunk_growth == VTK::HDFChunkGrowth::across_steps;
+    return opts;
+}
+
 //! Read the vtk-hdf file type from an hdf5 file
 template<typename C>
 std::string get_file_type(const HDF5::File<C>& file) {
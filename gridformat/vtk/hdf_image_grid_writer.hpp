@@ -14,6 +14,7 @@
 #include <algorithm>
 #include <utility>
 #include <tuple>
+#include <optional>
 
 #include <gridformat/common/exceptions.hpp>
 #include <gridformat/common/md_layout.hpp>
@@ -66,15 +67,20 @@ class VTKHDFImageGridWriterImpl : public GridDetail::WriterBase<is_transient, Gr
     };
 
  public:
-    explicit VTKHDFImageGridWriterImpl(LValueReferenceOf<const Grid> grid)
+    explicit VTKHDFImageGridWriterImpl(LValueReferenceOf<const Grid> grid,
+                                       HDF5::DataSetOptions dataset_opts = {})
         requires(std::is_same_v<Communicator, NullCommunicator>)
     : GridWriter<Grid>(grid.get(), ".hdf", writer_opts)
+    , _dataset_opts{std::move(dataset_opts)}
     {}
 
-    explicit VTKHDFImageGridWriterImpl(LValueReferenceOf<const Grid> grid, const Communicator& comm)
+    explicit VTKHDFImageGridWriterImpl(LValueReferenceOf<const Grid> grid,
+                                       const Communicator& comm,
+                                       HDF5::DataSetOptions dataset_opts = {})
         requires(std::is_copy_constructible_v<Communicator>)
     : GridWriter<Grid>(grid.get(), ".hdf", writer_opts)
     , _comm{comm}
+    , _dataset_opts{std::move(dataset_opts)}
     {}
 
     explicit VTKHDFImageGridWriterImpl(LValueReferenceOf<const Grid> grid,
@@ -82,9 +88,12 @@ class VTKHDFImageGridWriterImpl : public GridDetail::WriterBase<is_transient, Gr
                                        VTK::HDFTransientOptions opts = {
                                             .static_grid = true,
                                             .static_meta_data = false
-                                       })
+                                       },
+                                       HDF5::DataSetOptions dataset_opts = {})
         requires(is_transient && std::is_same_v<Communicator, NullCommunicator>)
-    : VTKHDFImageGridWriterImpl(grid.get(), NullCommunicator{}, filename_without_extension, std::move(opts))
+    : VTKHDFImageGridWriterImpl(
+        grid.get(), NullCommunicator{}, filename_without_extension, std::move(opts), std::move(dataset_opts)
+    )
     {}
 
     explicit VTKHDFImageGridWriterImpl(LValueReferenceOf<const Grid> grid,
@@ -93,12 +102,14 @@ class VTKHDFImageGridWriterImpl : public GridDetail::WriterBase<is_transient, Gr
                                        VTK::HDFTransientOptions opts = {
                                             .static_grid = true,
                                             .static_meta_data = false
-                                       })
+                                       },
+                                       HDF5::DataSetOptions dataset_opts = {})
         requires(is_transient && std::is_copy_constructible_v<Communicator>)
     : TimeSeriesGridWriter<Grid>(grid.get(), writer_opts)
     , _comm{comm}
     , _timeseries_filename{std::move(filename_without_extension) + ".hdf"}
-    , _transient_opts{std::move(opts)} {
+    , _transient_opts{std::move(opts)}
+    , _dataset_opts{VTKHDF::with_transient_options(std::move(dataset_opts), _transient_opts)} {
         if (!_transient_opts.static_grid)
             throw ValueError("Transient VTK-HDF ImageData files do not support evolving grids");
     }
@@ -118,18 +129,27 @@ class VTKHDFImageGridWriterImpl : public GridDetail::WriterBase<is_transient, Gr
 
         if (this->_step_count == 0)
             HDF5File::clear(_timeseries_filename, _comm);
+        if (!_file) {
+            _file.emplace(_timeseries_filename, _comm, HDF5File::Mode::append, _dataset_opts);
+            _file->set_flush_after_write(!_transient_opts.keep_file_open);
+        }
 
-        HDF5File file{_timeseries_filename, _comm, HDF5File::Mode::append};
+        auto& file = _file.value();
         _write_to(file);
         file.write_attribute(this->_step_count+1, "/VTKHDF/Steps/NSteps");
         file.write(std::array{t}, "/VTKHDF/Steps/Values");
+
+        if (!_transient_opts.keep_file_open)
+            _file.reset();
+        else if (_transient_opts.flush_interval > 0 && (this->_step_count + 1)%_transient_opts.flush_interval == 0)
+            file.flush();
         return _timeseries_filename;
     }
 
     void _write(const std::string& filename_with_ext) const {
         if constexpr (is_transient)
             throw InvalidState("This overload only works for non-transient output");
-        HDF5File file{filename_with_ext, _comm, HDF5File::Mode::overwrite};
+        HDF5File file{filename_with_ext, _comm, HDF5File::Mode::overwrite, _dataset_opts};
         _write_to(file);
     }
 
@@ -375,6 +395,8 @@ class VTKHDFImageGridWriterImpl : public GridDetail::WriterBase<is_transient, Gr
     Communicator _comm;
     std::string _timeseries_filename = "";
     VTK::HDFTransientOptions _transient_opts;
+    HDF5::DataSetOptions _dataset_opts;
+    std::optional<HDF5File> _file;  // open file of transient output
 };
 
 /*!
@@ -400,14 +422,14 @@ class VTKHDFImageGridTimeSeriesWriter : public VTKHDFImageGridWriterImpl<true, G
 };
 
 template<Concepts::ImageGrid G>
-VTKHDFImageGridWriter(const G&) -> VTKHDFImageGridWriter<G, NullCommunicator>;
+VTKHDFImageGridWriter(const G&, HDF5::DataSetOptions = {}) -> VTKHDFImageGridWriter<G, NullCommunicator>;
 template<Concepts::ImageGrid G, Concepts::Communicator C>
-VTKHDFImageGridWriter(const G&, const C&) -> VTKHDFImageGridWriter<G, C>;
+VTKHDFImageGridWriter(const G&, const C&, HDF5::DataSetOptions = {}) -> VTKHDFImageGridWriter<G, C>;
 
 template<Concepts::ImageGrid G>
-VTKHDFImageGridTimeSeriesWriter(const G&, std::string, VTK::HDFTransientOptions = {}) -> VTKHDFImageGridTimeSeriesWriter<G, NullCommunicator>;
+VTKHDFImageGridTimeSeriesWriter(const G&, std::string, VTK::HDFTransientOptions = {}, HDF5::DataSetOptions = {}) -> VTKHDFImageGridTimeSeriesWriter<G, NullCommunicator>;
 template<Concepts::ImageGrid G, Concepts::Communicator C>
-VTKHDFImageGridTimeSeriesWriter(const G&, const C&, std::string, VTK::HDFTransientOptions = {}) -> VTKHDFImageGridTimeSeriesWriter<G, C>;
+VTKHDFImageGridTimeSeriesWriter(const G&, const C&, std::string, VTK::HDFTransientOptions = {}, HDF5::DataSetOptions = {}) -> VTKHDFImageGridTimeSeriesWriter<G, C>;
 
 
 namespace Traits {
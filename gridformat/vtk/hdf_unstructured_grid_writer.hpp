@@ -11,11 +11,18 @@
 
 #include <type_traits>
 #include <ostream>
+#include <optional>
+#include <limits>
+#include <cstdint>
+#include <vector>
+#include <string>
 
 #include <gridformat/common/exceptions.hpp>
 #include <gridformat/common/md_layout.hpp>
 #include <gridformat/common/concepts.hpp>
 #include <gridformat/common/lvalue_reference.hpp>
+#include <gridformat/common/range_field.hpp>
+#include <gridformat/common/field_transformations.hpp>
 
 #include <gridformat/parallel/communication.hpp>
 #include <gridformat/parallel/concepts.hpp>
@@ -56,36 +63,45 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
  public:
     using Grid = G;
 
-    explicit VTKHDFUnstructuredGridWriterImpl(LValueReferenceOf<const Grid> grid)
+    explicit VTKHDFUnstructuredGridWriterImpl(LValueReferenceOf<const Grid> grid,
+                                              HDF5::DataSetOptions dataset_opts = {})
         requires(!is_transient && std::is_same_v<Communicator, NullCommunicator>)
     : GridWriter<Grid>(grid.get(), ".hdf", writer_opts)
+    , _dataset_opts{std::move(dataset_opts)}
     {}
 
-    explicit VTKHDFUnstructuredGridWriterImpl(LValueReferenceOf<const Grid> grid, const Communicator& comm)
+    explicit VTKHDFUnstructuredGridWriterImpl(LValueReferenceOf<const Grid> grid,
+                                              const Communicator& comm,
+                                              HDF5::DataSetOptions dataset_opts = {})
         requires(!is_transient && std::is_copy_constructible_v<Communicator>)
     : GridWriter<Grid>(grid.get(), ".hdf", writer_opts)
     , _comm{comm}
+    , _dataset_opts{std::move(dataset_opts)}
     {}
 
     explicit VTKHDFUnstructuredGridWriterImpl(LValueReferenceOf<const Grid> grid,
                                               std::string filename_without_extension,
-                                              VTK::HDFTransientOptions opts = {})
+                                              VTK::HDFTransientOptions opts = {},
+                                              HDF5::DataSetOptions dataset_opts = {})
         requires(is_transient && std::is_same_v<Communicator, NullCommunicator>)
     : TimeSeriesGridWriter<Grid>(grid.get(), writer_opts)
     , _comm{}
     , _timeseries_filename{std::move(filename_without_extension) + ".hdf"}
     , _transient_opts{std::move(opts)}
+    , _dataset_opts{VTKHDF::with_transient_options(std::move(dataset_opts), _transient_opts)}
     {}
 
     explicit VTKHDFUnstructuredGridWriterImpl(LValueReferenceOf<const Grid> grid,
                                               const Communicator& comm,
                                               std::string filename_without_extension,
-                                              VTK::HDFTransientOptions opts = {})
+                                              VTK::HDFTransientOptions opts = {},
+                                              HDF5::DataSetOptions dataset_opts = {})
         requires(is_transient && std::is_copy_constructible_v<Communicator>)
     : TimeSeriesGridWriter<Grid>(grid.get(), writer_opts)
     , _comm{comm}
     , _timeseries_filename{std::move(filename_without_extension) + ".hdf"}
     , _transient_opts{std::move(opts)}
+    , _dataset_opts{VTKHDF::with_transient_options(std::move(dataset_opts), _transient_opts)}
     {}
 
     const Communicator& communicator() const {
@@ -100,7 +116,7 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
     void _write(const std::string& filename_with_ext) const {
         if constexpr (is_transient)
             throw InvalidState("This overload only works for non-transient output");
-        HDF5File file{filename_with_ext, _comm, HDF5File::overwrite};
+        HDF5File file{filename_with_ext, _comm, HDF5File::overwrite, _dataset_opts};
         _write_to(file);
     }
 
@@ -110,8 +126,12 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
 
         if (this->_step_count == 0)
             HDF5File::clear(_timeseries_filename, _comm);
+        if (!_file) {
+            _file.emplace(_timeseries_filename, _comm, HDF5File::append, _dataset_opts);
+            _file->set_flush_after_write(!_transient_opts.keep_file_open);
+        }
 
-        HDF5File file{_timeseries_filename, _comm, HDF5File::append};
+        auto& file = _file.value();
         const auto offsets = _write_to(file);
 
         file.write_attribute(this->_step_count+1, "/VTKHDF/Steps/NSteps");
@@ -120,18 +140,22 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
         file.write(std::vector{std::array{offsets.cell_offset}}, "/VTKHDF/Steps/CellOffsets");
         file.write(std::vector{std::array{offsets.connectivity_offset}}, "VTKHDF/Steps/ConnectivityIdOffsets");
 
+        const std::size_t part_offset = [&] () -> std::size_t {
+            if (this->_step_count == 0)
+                return 0;
+            if (_transient_opts.static_grid)
+                return _last_part_offset;
+            return _last_part_offset + Parallel::size(_comm);
+        } ();
         file.write(std::vector{Parallel::size(_comm)}, "/VTKHDF/Steps/NumberOfParts");
-        if (this->_step_count > 0 && _transient_opts.static_grid) {
-            file.write(
-                std::vector{_get_last_step_data(file, "PartOffsets")},
-                "/VTKHDF/Steps/PartOffsets"
-            );
-        } else {
-            const std::size_t offset = this->_step_count == 0
-                ? 0
-                : _get_last_step_data(file, "PartOffsets") + Parallel::size(_comm);
-            file.write(std::vector{offset}, "/VTKHDF/Steps/PartOffsets");
-        }
+        file.write(std::vector{part_offset}, "/VTKHDF/Steps/PartOffsets");
+
+        _last_step_offsets = offsets;
+        _last_part_offset = part_offset;
+        if (!_transient_opts.keep_file_open)
+            _file.reset();
+        else if (_transient_opts.flush_interval > 0 && (this->_step_count + 1)%_transient_opts.flush_interval == 0)
+            file.flush();
 
         return _timeseries_filename;
     }
@@ -144,9 +168,8 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
         const auto context = IOContext::from(this->grid(), _comm, root_rank);
         _write_num_cells_and_points(file, context);
         offsets.point_offset = _write_coordinates(file, context);
-        offsets.connectivity_offset = _write_connectivity(file, context);
+        offsets.connectivity_offset = _write_connectivity_and_offsets(file, context);
         offsets.cell_offset = _write_types(file, context);
-        _write_offsets(file, context);
         _write_meta_data(file);
         _write_point_fields(file, context);
         _write_cell_fields(file, context);
@@ -162,7 +185,7 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
     std::size_t _write_coordinates(HDF5File& file, const IOContext& context) const {
         if constexpr (is_transient) {
             if (this->_step_count > 0 && _transient_opts.static_grid)
-                return _get_last_step_data(file, "PointOffsets");
+                return _last_step_offsets.point_offset;
         }
         const auto coords_field = VTK::make_coordinates_field<CT>(this->grid(), false);
         const auto offset = _get_current_offset(file, "/VTKHDF/Points");
@@ -170,49 +193,62 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
         return offset;
     }
 
-    std::size_t _write_connectivity(HDF5File& file, const IOContext& context) const {
+    std::size_t _write_connectivity_and_offsets(HDF5File& file, const IOContext& context) const {
         if constexpr (is_transient) {
             if (this->_step_count > 0 && _transient_opts.static_grid)
-                return _get_last_step_data(file, "ConnectivityIdOffsets");
+                return _last_step_offsets.connectivity_offset;
         }
         const auto point_id_map = make_point_id_map(this->grid());
-        const auto connectivity_field = VTK::make_connectivity_field(this->grid(), point_id_map);
-        const auto num_entries = connectivity_field->layout().number_of_entries();
-        const auto my_num_ids = std::vector{static_cast<long>(num_entries)};
-        std::vector<long> connectivity(num_entries);
-        connectivity_field->export_to(connectivity);
         const auto offset = _get_current_offset(file, "/VTKHDF/Connectivity");
-        _write_values(file, "/VTKHDF/Connectivity", connectivity, context);
-        _write_values(file, "/VTKHDF/NumberOfConnectivityIds", my_num_ids, context);
+        const auto write_connectivity = [&] <typename I> (const Precision<I>&) {
+            const auto connectivity_field = VTK::make_connectivity_field<I>(this->grid(), point_id_map);
+            _write_stacked_field(file, "/VTKHDF/Connectivity", *connectivity_field, context);
+            return connectivity_field->layout().number_of_entries();
+        };
+        const std::size_t num_ids = _visit_id_precision(
+            file, "/VTKHDF/Connectivity", context.num_points_total, write_connectivity
+        );
+        _write_values(file, "/VTKHDF/NumberOfConnectivityIds", std::vector{static_cast<long>(num_ids)}, context);
+
+        // offsets of each piece start with a zero and end with its number of connectivity ids
+        const std::size_t num_ids_total = context.is_parallel
+            ? Parallel::broadcast(_comm, Parallel::sum(_comm, num_ids, root_rank), root_rank)
+            : num_ids;
+        _visit_id_precision(file, "/VTKHDF/Offsets", num_ids_total, [&] <typename I> (const Precision<I>&) {
+            const MergedField offsets_field{
+                make_field_ptr(RangeField{std::vector{I{0}}}),
+                VTK::make_offsets_field<I>(this->grid())
+            };
+            _write_stacked_field(file, "/VTKHDF/Offsets", offsets_field, context);
+        });
         return offset;
     }
 
     std::size_t _write_types(HDF5File& file, const IOContext& context) const {
         if constexpr (is_transient) {
             if (this->_step_count > 0 && _transient_opts.static_grid)
-                return _get_last_step_data(file, "CellOffsets");
+                return _last_step_offsets.cell_offset;
         }
         const auto types_field = VTK::make_cell_types_field(this->grid());
-        std::vector<std::uint8_t> types(types_field->layout().number_of_entries());
-        types_field->export_to(types);
         const auto offset = _get_current_offset(file, "VTKHDF/Types");
-        _write_values(file, "VTKHDF/Types", types, context);
+        _write_stacked_field(file, "VTKHDF/Types", *types_field, context);
         return offset;
     }
 
-    std::size_t _write_offsets(HDF5File& file, const IOContext& context) const {
-        if constexpr (is_transient) {
-            if (this->_step_count > 0 && _transient_opts.static_grid)
-                return _get_last_step_data(file, "CellOffsets");
-        }
-        const auto offsets_field = VTK::make_offsets_field(this->grid());
-        const auto num_offset_entries = offsets_field->layout().number_of_entries() + 1;
-        std::vector<long> offsets(num_offset_entries);
-        offsets_field->export_to(std::ranges::subrange(std::next(offsets.begin()), offsets.end()));
-        offsets[0] = long{0};
-        const auto offset = _get_current_offset(file, "/VTKHDF/Offsets");
-        _write_values(file, "/VTKHDF/Offsets", offsets, context);
-        return offset;
+    // VTKHDF allows for 32-bit ids, which we use if all values fit (and if previous steps used them)
+    template<typename Action>
+    decltype(auto) _visit_id_precision(const HDF5File& file,
+                                       const std::string& path,
+                                       std::size_t max_value,
+                                       Action&& action) const {
+        static constexpr std::size_t max_32bit_value = std::numeric_limits<std::int32_t>::max();
+        const auto existing_precision = file.get_precision(path);
+        const bool use_32bit = existing_precision
+            ? existing_precision.value() == DynamicPrecision{Precision<std::int32_t>{}}
+            : max_value <= max_32bit_value;
+        if (use_32bit && max_value > max_32bit_value)
+            throw ValueError("Ids in '" + path + "' exceed the 32-bit range used in the previous steps");
+        return use_32bit ? action(Precision<std::int32_t>{}) : action(Precision<std::int64_t>{});
     }
 
     void _write_meta_data(HDF5File& file) const {
@@ -291,6 +327,21 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
         }
     }
 
+    // write a field whose pieces are stacked along the first dimension in parallel output
+    void _write_stacked_field(HDF5File& file,
+                              const std::string& path,
+                              const Field& field,
+                              const IOContext& context) const {
+        const std::size_t my_size = field.layout().extent(0);
+        if (context.is_parallel) {
+            const auto total_size = Parallel::sum(_comm, my_size, root_rank);
+            const auto my_total_size = Parallel::broadcast(_comm, total_size, root_rank);
+            _write_field(file, path, field, true, _accumulate_rank_offset(my_size), my_total_size);
+        } else {
+            _write_field(file, path, field, false, 0, my_size);
+        }
+    }
+
     void _write_point_field(HDF5File& file,
                             const std::string& path,
                             const Field& field,
@@ -355,27 +406,15 @@ class VTKHDFUnstructuredGridWriterImpl : public GridDetail::WriterBase<is_transi
         return cur_dimensions ? (*cur_dimensions)[0] : 0;
     }
 
-    std::size_t _get_last_step_data(const HDF5File& file, const std::string& sub_path) const {
-        if (this->_step_count == 0)
-            throw ValueError("Last step data can only be read after at least one write");
-        const std::string path ="VTKHDF/Steps/" + sub_path;
-
-        auto step_dimensions = file.get_dimensions(path).value();
-        std::ranges::fill(step_dimensions, std::size_t{1});
-
-        auto access_offset = step_dimensions;
-        std::ranges::fill(access_offset, std::size_t{0});
-        access_offset.at(0) = this->_step_count - 1;
-
-        return file.template read_dataset_to<std::size_t>(path, HDF5::Slice{
-            .offset = access_offset,
-            .count = step_dimensions
-        });
-    }
-
     Communicator _comm;
     std::string _timeseries_filename = "";
     VTK::HDFTransientOptions _transient_opts;
+    HDF5::DataSetOptions _dataset_opts;
+
+    // file and bookkeeping of the last step in transient output
+    std::optional<HDF5File> _file;
+    TimeSeriesOffsets _last_step_offsets{};
+    std::size_t _last_part_offset = 0;
 };
 
 /*!
@@ -401,14 +440,14 @@ class VTKHDFUnstructuredTimeSeriesWriter : public VTKHDFUnstructuredGridWriterIm
 };
 
 template<Concepts::UnstructuredGrid G>
-VTKHDFUnstructuredGridWriter(const G&) -> VTKHDFUnstructuredGridWriter<G, NullCommunicator>;
+VTKHDFUnstructuredGridWriter(const G&, HDF5::DataSetOptions = {}) -> VTKHDFUnstructuredGridWriter<G, NullCommunicator>;
 template<Concepts::UnstructuredGrid G, Concepts::Communicator C>
-VTKHDFUnstructuredGridWriter(const G&, const C&) -> VTKHDFUnstructuredGridWriter<G, C>;
+VTKHDFUnstructuredGridWriter(const G&, const C&, HDF5::DataSetOptions = {}) -> VTKHDFUnstructuredGridWriter<G, C>;
 
 template<Concepts::UnstructuredGrid G>
-VTKHDFUnstructuredTimeSeriesWriter(const G&, std::string, VTK::HDFTransientOptions = {}) -> VTKHDFUnstructuredTimeSeriesWriter<G, NullCommunicator>;
+VTKHDFUnstructuredTimeSeriesWriter(const G&, std::string, VTK::HDFTransientOptions = {}, HDF5::DataSetOptions = {}) -> VTKHDFUnstructuredTimeSeriesWriter<G, NullCommunicator>;
 template<Concepts::UnstructuredGrid G, Concepts::Communicator C>
-VTKHDFUnstructuredTimeSeriesWriter(const G&, const C&, std::string, VTK::HDFTransientOptions = {}) -> VTKHDFUnstructuredTimeSeriesWriter<G, C>;
+VTKHDFUnstructuredTimeSeriesWriter(const G&, const C&, std::string, VTK::HDFTransientOptions = {}, HDF5::DataSetOptions = {}) -> VTKHDFUnstructuredTimeSeriesWriter<G, C>;
 
 }  // namespace GridFormat
 
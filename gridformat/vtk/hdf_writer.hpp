@@ -60,10 +60,10 @@ class VTKHDFWriter : public VTKHDFDetail::VTKHDFWriterSelector<Grid, Communicato
 };
 
 template<typename Grid>
-VTKHDFWriter(const Grid&) -> VTKHDFWriter<Grid>;
+VTKHDFWriter(const Grid&, HDF5::DataSetOptions = {}) -> VTKHDFWriter<Grid>;
 
 template<typename Grid, Concepts::Communicator Comm>
-VTKHDFWriter(const Grid&, const Comm&) -> VTKHDFWriter<Grid, Comm>;
+VTKHDFWriter(const Grid&, const Comm&, HDF5::DataSetOptions = {}) -> VTKHDFWriter<Grid, Comm>;
 
 
 /*!
@@ -80,9 +80,9 @@ class VTKHDFTimeSeriesWriter : public VTKHDFDetail::VTKHDFTimeSeriesWriterSelect
 };
 
 template<Concepts::Grid Grid>
-VTKHDFTimeSeriesWriter(const Grid&, std::string, VTK::HDFTransientOptions = {}) -> VTKHDFTimeSeriesWriter<Grid>;
+VTKHDFTimeSeriesWriter(const Grid&, std::string, VTK::HDFTransientOptions = {}, HDF5::DataSetOptions = {}) -> VTKHDFTimeSeriesWriter<Grid>;
 template<Concepts::Grid Grid, Concepts::Communicator C>
-VTKHDFTimeSeriesWriter(const Grid&, C, std::string, VTK::HDFTransientOptions = {}) -> VTKHDFTimeSeriesWriter<Grid, C>;
+VTKHDFTimeSeriesWriter(const Grid&, C, std::string, VTK::HDFTransientOptions = {}, HDF5::DataSetOptions = {}) -> VTKHDFTimeSeriesWriter<Grid, C>;
 
 namespace Traits {
 
@@ -18,12 +18,18 @@
 #include <numeric>
 #include <tuple>
 #include <cmath>
+#include <span>
+#include <cstddef>
+#include <optional>
 
 #include <gridformat/common/math.hpp>
 #include <gridformat/common/exceptions.hpp>
 #include <gridformat/common/concepts.hpp>
 #include <gridformat/common/ranges.hpp>
 #include <gridformat/common/field.hpp>
+#include <gridformat/common/md_layout.hpp>
+#include <gridformat/common/precision.hpp>
+#include <gridformat/common/serialization.hpp>
 #include <gridformat/grid/grid.hpp>
 
 #include <gridformat/parallel/communication.hpp>
@@ -40,6 +46,57 @@ namespace GridFormat::PVTK {
     return base_name + "-" + std::to_string(rank);
 }
 
+/*!
+ * \brief Field that holds the concatenated values of a field on several processes.
+ * \details The layout is that of the given (local) field, with the first extent adjusted
+ *          to the number of tuples contained in the gathered values.
+ */
+class GatheredField : public Field {
+ public:
+    GatheredField(const Field& local_field, std::vector<std::byte>&& gathered_values)
+    : _md_layout{_make_layout(local_field, gathered_values.size())}
+    , _prec{local_field.precision()}
+    , _values{std::move(gathered_values)}
+    {}
+
+ private:
+    static MDLayout _make_layout(const Field& field, std::size_t number_of_bytes) {
+        const auto layout = field.layout();
+        const std::size_t tuple_size = layout.dimension() > 1 ? layout.number_of_entries(1) : 1;
+        const std::size_t tuple_size_in_bytes = tuple_size*field.precision().size_in_bytes();
+        if (tuple_size_in_bytes == 0 || number_of_bytes%tuple_size_in_bytes != 0)
+            throw SizeError("Gathered values do not match the tuple size of the field");
+
+        std::vector<std::size_t> extents(std::max(layout.dimension(), std::size_t{1}));
+        if (layout.dimension() > 0)
+            layout.export_to(extents);
+        extents[0] = number_of_bytes/tuple_size_in_bytes;
+        return MDLayout{std::move(extents)};
+    }
+
+    MDLayout _layout() const override {
+        return _md_layout;
+    }
+
+    DynamicPrecision _precision() const override {
+        return _prec;
+    }
+
+    std::optional<std::span<const std::byte>> _contiguous_bytes() const override {
+        return std::span<const std::byte>{_values};
+    }
+
+    Serialization _serialized() const override {
+        Serialization result{_values.size()};
+        std::ranges::copy(_values, result.as_span().begin());
+        return result;
+    }
+
+    MDLayout _md_layout;
+    DynamicPrecision _prec;
+    std::vector<std::byte> _values;
+};
+
 //! Helper to add a PDataArray child to an xml element
 template<typename Encoder, typename DataFormat>
 class PDataArrayHelper {
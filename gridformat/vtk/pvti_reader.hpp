@@ -8,6 +8,7 @@
 #ifndef GRIDFORMAT_VTK_PVTI_READER_HPP_
 #define GRIDFORMAT_VTK_PVTI_READER_HPP_
 
+#include <utility>
 #include <gridformat/vtk/vti_reader.hpp>
 #include <gridformat/vtk/pxml_reader.hpp>
 
@@ -26,13 +27,17 @@ class PVTIReader : public VTK::PXMLStructuredGridReader<VTIReader> {
     : ParentType("PImageData")
     {}
 
-    explicit PVTIReader(const NullCommunicator&)
-    : ParentType("PImageData")
+    explicit PVTIReader(VTK::XMLReaderOptions opts)
+    : ParentType("PImageData", std::move(opts))
+    {}
+
+    explicit PVTIReader(const NullCommunicator&, VTK::XMLReaderOptions opts = {})
+    : ParentType("PImageData", std::move(opts))
     {}
 
     template<Concepts::Communicator C>
-    explicit PVTIReader(const C& comm)
-    : ParentType("PImageData", comm)
+    explicit PVTIReader(const C& comm, VTK::XMLReaderOptions opts = {})
+    : ParentType("PImageData", comm, {}, std::move(opts))
     {}
 
  private:
@@ -103,6 +103,7 @@ class PVTIWriter : public VTK::XMLWriterBase<Grid, PVTIWriter<Grid, Communicator
         auto writer = VTIWriter{this->grid(), this->_xml_opts}
                         .as_piece_for(std::move(domain))
                         .with_offset(offset);
+        this->_share_grid_array_cache_with(writer);
         this->copy_fields(writer);
         writer.write(PVTK::piece_basefilename(par_filename, Parallel::rank(_comm)));
     }
@@ -8,6 +8,7 @@
 #ifndef GRIDFORMAT_VTK_PVTP_READER_HPP_
 #define GRIDFORMAT_VTK_PVTP_READER_HPP_
 
+#include <utility>
 #include <optional>
 
 #include <gridformat/vtk/vtp_reader.hpp>
@@ -28,13 +29,19 @@ class PVTPReader : public VTK::PXMLUnstructuredGridReader<VTPReader> {
     : ParentType("PPolyData")
     {}
 
-    explicit PVTPReader(const NullCommunicator&)
-    : ParentType("PPolyData")
+    explicit PVTPReader(VTK::XMLReaderOptions opts)
+    : ParentType("PPolyData", std::move(opts))
+    {}
+
+    explicit PVTPReader(const NullCommunicator&, VTK::XMLReaderOptions opts = {})
+    : ParentType("PPolyData", std::move(opts))
     {}
 
     template<Concepts::Communicator C>
-    explicit PVTPReader(const C& comm, std::optional<bool> merge_exceeding_pieces = {})
-    : ParentType("PPolyData", comm, merge_exceeding_pieces)
+    explicit PVTPReader(const C& comm,
+                        std::optional<bool> merge_exceeding_pieces = {},
+                        VTK::XMLReaderOptions opts = {})
+    : ParentType("PPolyData", comm, merge_exceeding_pieces, std::move(opts))
     {}
 
  private:
@@ -70,6 +70,7 @@ class PVTPWriter : public VTK::XMLWriterBase<Grid, PVTPWriter<Grid, Communicator
 
     void _write_piece(const std::string& par_filename) const {
         VTPWriter writer{this->grid(), this->_xml_opts};
+        this->_share_grid_array_cache_with(writer);
         this->copy_fields(writer);
         writer.write(PVTK::piece_basefilename(par_filename, Parallel::rank(_comm)));
     }
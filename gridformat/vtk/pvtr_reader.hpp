@@ -8,6 +8,7 @@
 #ifndef GRIDFORMAT_VTK_PVTR_READER_HPP_
 #define GRIDFORMAT_VTK_PVTR_READER_HPP_
 
+#include <utility>
 #include <algorithm>
 #include <unordered_map>
 #include <vector>
@@ -33,13 +34,17 @@ class PVTRReader : public VTK::PXMLStructuredGridReader<VTRReader> {
     : ParentType("PRectilinearGrid")
     {}
 
-    explicit PVTRReader(const NullCommunicator&)
-    : ParentType("PRectilinearGrid")
+    explicit PVTRReader(VTK::XMLReaderOptions opts)
+    : ParentType("PRectilinearGrid", std::move(opts))
+    {}
+
+    explicit PVTRReader(const NullCommunicator&, VTK::XMLReaderOptions opts = {})
+    : ParentType("PRectilinearGrid", std::move(opts))
     {}
 
     template<Concepts::Communicator C>
-    explicit PVTRReader(const C& comm)
-    : ParentType("PRectilinearGrid", comm)
+    explicit PVTRReader(const C& comm, VTK::XMLReaderOptions opts = {})
+    : ParentType("PRectilinearGrid", comm, {}, std::move(opts))
     {}
 
  private:
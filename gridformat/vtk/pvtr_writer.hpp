@@ -113,6 +113,7 @@ class PVTRWriter : public VTK::XMLWriterBase<Grid, PVTRWriter<Grid, Communicator
         auto writer = VTRWriter{this->grid(), this->_xml_opts}
                         .as_piece_for(std::move(domain))
                         .with_offset(offset);
+        this->_share_grid_array_cache_with(writer);
         this->copy_fields(writer);
         writer.write(PVTK::piece_basefilename(par_filename, Parallel::rank(_comm)));
     }
@@ -8,6 +8,7 @@
 #ifndef GRIDFORMAT_VTK_PVTS_READER_HPP_
 #define GRIDFORMAT_VTK_PVTS_READER_HPP_
 
+#include <utility>
 #include <gridformat/vtk/vts_reader.hpp>
 #include <gridformat/vtk/pxml_reader.hpp>
 
@@ -26,13 +27,17 @@ class PVTSReader : public VTK::PXMLStructuredGridReader<VTSReader> {
     : ParentType("PStructuredGrid")
     {}
 
-    explicit PVTSReader(const NullCommunicator&)
-    : ParentType("PStructuredGrid")
+    explicit PVTSReader(VTK::XMLReaderOptions opts)
+    : ParentType("PStructuredGrid", std::move(opts))
+    {}
+
+    explicit PVTSReader(const NullCommunicator&, VTK::XMLReaderOptions opts = {})
+    : ParentType("PStructuredGrid", std::move(opts))
     {}
 
     template<Concepts::Communicator C>
-    explicit PVTSReader(const C& comm)
-    : ParentType("PStructuredGrid", comm)
+    explicit PVTSReader(const C& comm, VTK::XMLReaderOptions opts = {})
+    : ParentType("PStructuredGrid", comm, {}, std::move(opts))
     {}
 
  private:
@@ -8,6 +8,7 @@
 #ifndef GRIDFORMAT_VTK_PVTU_READER_HPP_
 #define GRIDFORMAT_VTK_PVTU_READER_HPP_
 
+#include <utility>
 #include <optional>
 
 #include <gridformat/vtk/vtu_reader.hpp>
@@ -28,13 +29,19 @@ class PVTUReader : public VTK::PXMLUnstructuredGridReader<VTUReader> {
     : ParentType("PUnstructuredGrid")
     {}
 
-    explicit PVTUReader(const NullCommunicator&)
-    : ParentType("PUnstructuredGrid")
+    explicit PVTUReader(VTK::XMLReaderOptions opts)
+    : ParentType("PUnstructuredGrid", std::move(opts))
+    {}
+
+    explicit PVTUReader(const NullCommunicator&, VTK::XMLReaderOptions opts = {})
+    : ParentType("PUnstructuredGrid", std::move(opts))
     {}
 
     template<Concepts::Communicator C>
-    explicit PVTUReader(const C& comm, std::optional<bool> merge_exceeding_pieces = {})
-    : ParentType("PUnstructuredGrid", comm, merge_exceeding_pieces)
+    explicit PVTUReader(const C& comm,
+                        std::optional<bool> merge_exceeding_pieces = {},
+                        VTK::XMLReaderOptions opts = {})
+    : ParentType("PUnstructuredGrid", comm, merge_exceeding_pieces, std::move(opts))
     {}
 
  private:
@@ -12,10 +12,20 @@
 #include <string>
 #include <fstream>
 #include <filesystem>
+#include <array>
+#include <span>
+#include <vector>
+#include <ranges>
+#include <cstddef>
+#include <algorithm>
 
 #include <gridformat/common/exceptions.hpp>
+#include <gridformat/common/field.hpp>
+#include <gridformat/common/field_storage.hpp>
 #include <gridformat/common/lvalue_reference.hpp>
 #include <gridformat/parallel/communication.hpp>
+#include <gridformat/parallel/aggregation.hpp>
+#include <gridformat/parallel/concepts.hpp>
 #include <gridformat/parallel/helpers.hpp>
 
 #include <gridformat/grid/grid.hpp>
@@ -61,20 +71,156 @@ class PVTUWriter : public VTK::XMLWriterBase<Grid, PVTUWriter<Grid, Communicator
     }
 
     virtual void _write(const std::string& filename_with_ext) const override {
+        if (this->_xml_opts.ranks_per_piece > 1)
+            return _write_aggregated(filename_with_ext);
+
         _write_piece(filename_with_ext);
         Parallel::barrier(_comm);  // ensure all pieces finished successfully
         if (Parallel::rank(_comm) == 0)
-            _write_pvtu_file(filename_with_ext);
+            _write_pvtu_file(filename_with_ext, Parallel::ranks(_comm));
         Parallel::barrier(_comm);  // ensure .pvtu file is written before returning
     }
 
+    // Only the aggregators write pieces, containing the data of their group. The other processes return
+    // once they have sent their data, and the aggregators return once their piece is written (rank 0 after
+    // writing the .pvtu file).
+    void _write_aggregated(const std::string& filename_with_ext) const {
+        if constexpr (Concepts::PointToPointCommunicator<Communicator>) {
+            const Parallel::Aggregation aggregation{_comm, this->_xml_opts.ranks_per_piece};
+            _write_aggregated_piece(filename_with_ext, aggregation);
+            if (!aggregation.is_aggregator())
+                return;
+
+            if (Parallel::rank(_comm) != 0) {
+                Parallel::send(_comm, std::array{1}, 0);  // notify rank 0 that our piece is written
+                return;
+            }
+            std::ranges::for_each(aggregation.aggregators() | std::views::drop(1), [&] (int rank) {
+                Parallel::receive<int>(_comm, rank);
+            });
+            _write_pvtu_file(filename_with_ext, aggregation.aggregators());
+        } else {
+            throw NotImplemented("Writing pieces of multiple ranks requires point-to-point communication");
+        }
+    }
+
+    template<typename Aggregation>
+    void _write_aggregated_piece(const std::string& par_filename, const Aggregation& aggregation) const {
+        const auto gather = [&] (const Field& field) -> FieldPtr {
+            auto values = aggregation.gather(field.serialized().as_span());
+            if (!aggregation.is_aggregator())
+                return nullptr;
+            return make_field_ptr(PVTK::GatheredField{field, std::move(values)});
+        };
+
+        // the grid arrays are only gathered once if the grid is static
+        const bool gather_grid = !this->_grid_array_cache || !this->_grid_array_cache->is_filled;
+        const std::size_t number_of_connectivity_ids = gather_grid ? _number_of_connectivity_ids() : 0;
+        const auto piece_sizes = aggregation.gather(std::array<std::size_t, 3>{
+            number_of_points(this->grid()),
+            number_of_cells(this->grid()),
+            number_of_connectivity_ids
+        });
+
+        FieldPtr coords_field, connectivity_field, offsets_field, types_field;
+        if (gather_grid) {
+            coords_field = std::visit([&] <typename T> (const Precision<T>&) {
+                return gather(*VTK::make_coordinates_field<T>(this->grid(), false));
+            }, this->_xml_settings.coordinate_precision);
+            std::visit([&] <typename T> (const Precision<T>&) {
+                const auto point_id_map = make_point_id_map(this->grid());
+                const auto connectivity = VTK::make_connectivity_field<T>(this->grid(), point_id_map);
+                const auto offsets = VTK::make_offsets_field<T>(this->grid());
+                auto connectivity_values = aggregation.gather(connectivity->serialized().as_span());
+                auto offset_values = aggregation.gather(offsets->serialized().as_span());
+                if (aggregation.is_aggregator()) {
+                    _shift_piece_ids<T>(connectivity_values, offset_values, piece_sizes);
+                    connectivity_field = make_field_ptr(PVTK::GatheredField{*connectivity, std::move(connectivity_values)});
+                    offsets_field = make_field_ptr(PVTK::GatheredField{*offsets, std::move(offset_values)});
+                }
+            }, this->_xml_settings.header_precision);
+            types_field = gather(*VTK::make_cell_types_field(this->grid()));
+        }
+
+        FieldStorage vtk_point_fields;
+        FieldStorage vtk_cell_fields;
+        std::ranges::for_each(this->_point_field_names(), [&] (const std::string& name) {
+            if (auto gathered = gather(*VTK::make_vtk_field(this->_get_point_field_ptr(name))))
+                vtk_point_fields.set(name, std::move(gathered));
+        });
+        std::ranges::for_each(this->_cell_field_names(), [&] (const std::string& name) {
+            if (auto gathered = gather(*VTK::make_vtk_field(this->_get_cell_field_ptr(name))))
+                vtk_cell_fields.set(name, std::move(gathered));
+        });
+
+        if (!aggregation.is_aggregator()) {
+            if (this->_grid_array_cache)  // keep track of whether our aggregator caches the grid arrays
+                this->_grid_array_cache->is_filled = true;
+            return;
+        }
+
+        std::size_t total_number_of_points = 0;
+        std::size_t total_number_of_cells = 0;
+        for (std::size_t i = 0; i < piece_sizes.size(); i += 3) {
+            total_number_of_points += piece_sizes[i];
+            total_number_of_cells += piece_sizes[i+1];
+        }
+
+        auto context = this->_get_write_context("UnstructuredGrid");
+        this->_set_attribute(context, "Piece", "NumberOfPoints", total_number_of_points);
+        this->_set_attribute(context, "Piece", "NumberOfCells", total_number_of_cells);
+        std::ranges::for_each(this->_point_field_names(), [&] (const std::string& name) {
+            this->_set_data_array(context, "Piece/PointData", name, vtk_point_fields.get(name));
+        });
+        std::ranges::for_each(this->_cell_field_names(), [&] (const std::string& name) {
+            this->_set_data_array(context, "Piece/CellData", name, vtk_cell_fields.get(name));
+        });
+        this->_set_grid_data_arrays(context, [&] (auto& grid_context) {
+            this->_set_data_array(grid_context, "Piece/Points", "Coordinates", *coords_field);
+            this->_set_data_array(grid_context, "Piece/Cells", "connectivity", *connectivity_field);
+            this->_set_data_array(grid_context, "Piece/Cells", "offsets", *offsets_field);
+            this->_set_data_array(grid_context, "Piece/Cells", "types", *types_field);
+        });
+
+        std::ofstream file_stream(PVTK::piece_basefilename(par_filename, Parallel::rank(_comm)) + ".vtu", std::ios::out);
+        this->_write_xml(std::move(context), file_stream);
+    }
+
+    std::size_t _number_of_connectivity_ids() const {
+        std::size_t result = 0;
+        for (const auto& cell : cells(this->grid()))
+            result += number_of_points(this->grid(), cell);
+        return result;
+    }
+
+    // make the connectivity & offsets of the gathered pieces refer to the points & ids of the merged piece
+    template<typename T>
+    void _shift_piece_ids(std::vector<std::byte>& connectivity,
+                          std::vector<std::byte>& offsets,
+                          const std::vector<std::size_t>& piece_sizes) const {
+        const std::span connectivity_values{reinterpret_cast<T*>(connectivity.data()), connectivity.size()/sizeof(T)};
+        const std::span offset_values{reinterpret_cast<T*>(offsets.data()), offsets.size()/sizeof(T)};
+        std::size_t point_offset = 0, cell_offset = 0, id_offset = 0;
+        for (std::size_t i = 0; i < piece_sizes.size(); i += 3) {
+            for (T& id : connectivity_values.subspan(id_offset, piece_sizes[i+2]))
+                id += static_cast<T>(point_offset);
+            for (T& offset : offset_values.subspan(cell_offset, piece_sizes[i+1]))
+                offset += static_cast<T>(id_offset);
+            point_offset += piece_sizes[i];
+            cell_offset += piece_sizes[i+1];
+            id_offset += piece_sizes[i+2];
+        }
+    }
+
     void _write_piece(const std::string& par_filename) const {
         VTUWriter writer{this->grid(), this->_xml_opts};
+        this->_share_grid_array_cache_with(writer);
         this->copy_fields(writer);
         writer.write(PVTK::piece_basefilename(par_filename, Parallel::rank(_comm)));
     }
 
-    void _write_pvtu_file(const std::string& filename_with_ext) const {
+    template<std::ranges::range PieceRanks>
+    void _write_pvtu_file(const std::string& filename_with_ext, const PieceRanks& piece_ranks) const {
         std::ofstream file_stream(filename_with_ext, std::ios::out);
 
         XMLElement pvtk_xml("VTKFile");
@@ -102,7 +248,7 @@ class PVTUWriter : public VTK::XMLWriterBase<Grid, PVTUWriter<Grid, Communicator
             point_array.set_attribute("type", VTK::attribute_name(prec));
         }, this->_xml_settings.coordinate_precision);
 
-        std::ranges::for_each(Parallel::ranks(_comm), [&] (int rank) {
+        std::ranges::for_each(piece_ranks, [&] (int rank) {
             grid.add_child("Piece").set_attribute("Source", std::filesystem::path{
                 PVTK::piece_basefilename(filename_with_ext, rank) + ".vtu"
             }.filename());
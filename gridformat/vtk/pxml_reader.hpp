@@ -56,19 +56,21 @@ class PXMLReaderBase : public GridReader {
     PXMLReaderBase& operator=(PXMLReaderBase&&) = default;
     PXMLReaderBase& operator=(const PXMLReaderBase&) = delete;
 
-    PXMLReaderBase(std::string vtk_grid_type)
+    PXMLReaderBase(std::string vtk_grid_type, XMLReaderOptions opts = {})
     : _vtk_grid_type{std::move(vtk_grid_type)}
+    , _xml_opts{std::move(opts)}
     {}
 
-    explicit PXMLReaderBase(std::string vtk_grid_type, const NullCommunicator&)
-    : PXMLReaderBase(std::move(vtk_grid_type))
+    explicit PXMLReaderBase(std::string vtk_grid_type, const NullCommunicator&, XMLReaderOptions opts = {})
+    : PXMLReaderBase(std::move(vtk_grid_type), std::move(opts))
     {}
 
     template<Concepts::Communicator C>
     explicit PXMLReaderBase(std::string vtk_grid_type,
                             const C& comm,
-                            std::optional<bool> merge_exceeding_pieces = {})
-    : PXMLReaderBase(std::move(vtk_grid_type)) {
+                            std::optional<bool> merge_exceeding_pieces = {},
+                            XMLReaderOptions opts = {})
+    : PXMLReaderBase(std::move(vtk_grid_type), std::move(opts)) {
         _num_ranks = Parallel::size(comm);
         _rank = Parallel::rank(comm);
         _merge_exceeding = merge_exceeding_pieces;
@@ -95,7 +97,7 @@ class PXMLReaderBase : public GridReader {
 
     XMLReaderHelper _read_pvtk_file(const std::string& filename, typename GridReader::FieldNames& fields) {
         _filename = filename;
-         auto helper = XMLReaderHelper::make_from(filename, _vtk_grid_type);
+         auto helper = XMLReaderHelper::make_from(filename, _vtk_grid_type, _xml_opts);
         _num_pieces_in_file = Ranges::size(_pieces_paths(helper));
         _read_pieces(helper);
         if (_piece_readers.size() > 0) {
@@ -202,10 +204,17 @@ class PXMLReaderBase : public GridReader {
             _read_parallel_piece(helper);
         else
             std::ranges::for_each(_pieces_paths(helper), [&] (const std::filesystem::path& path) {
-                _piece_readers.emplace_back(PieceReader{}).open(path);
+                _piece_readers.emplace_back(_make_piece_reader()).open(path);
             });
     }
 
+    PieceReader _make_piece_reader() const {
+        if constexpr (std::constructible_from<PieceReader, XMLReaderOptions>)
+            return PieceReader{_xml_opts};
+        else
+            return PieceReader{};
+    }
+
     void _read_parallel_piece(const XMLReaderHelper& helper) {
         const auto num_pieces = Ranges::size(_pieces_paths(helper));
         if (num_pieces < _num_ranks.value() && _rank.value() == 0)
@@ -227,12 +236,13 @@ class PXMLReaderBase : public GridReader {
             | std::views::drop(_rank.value())
             | std::views::take(my_num_pieces),
             [&] (const std::filesystem::path& path) {
-                _piece_readers.emplace_back(PieceReader{}).open(path);
+                _piece_readers.emplace_back(_make_piece_reader()).open(path);
             }
         );
     }
 
     std::string _vtk_grid_type;
+    XMLReaderOptions _xml_opts;
 
     std::optional<unsigned int> _num_ranks;
     std::optional<unsigned int> _rank;
@@ -33,6 +33,12 @@ namespace GridFormat {
  * \brief Reader for .vti file format
  */
 class VTIReader : public GridReader {
+ public:
+    VTIReader() = default;
+    explicit VTIReader(VTK::XMLReaderOptions opts)
+    : _xml_opts{std::move(opts)}
+    {}
+
  private:
     struct ImageSpecs {
         std::array<std::size_t, 6> extents;
@@ -42,7 +48,7 @@ class VTIReader : public GridReader {
     };
 
     void _open(const std::string& filename, typename GridReader::FieldNames& fields) override {
-        auto helper = VTK::XMLReaderHelper::make_from(filename, "ImageData");
+        auto helper = VTK::XMLReaderHelper::make_from(filename, "ImageData", _xml_opts);
         auto specs = ImageSpecs{};
         specs.extents = Ranges::array_from_string<std::size_t, 6>(helper.get("ImageData/Piece").get_attribute("Extent"));
         specs.spacing = Ranges::array_from_string<double, 3>(helper.get("ImageData").get_attribute("Spacing"));
@@ -169,6 +175,7 @@ class VTIReader : public GridReader {
         return _image_specs.value();
     }
 
+    VTK::XMLReaderOptions _xml_opts;
     std::optional<VTK::XMLReaderHelper> _helper;
     std::optional<ImageSpecs> _image_specs;
 };
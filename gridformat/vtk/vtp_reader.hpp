@@ -28,9 +28,15 @@ namespace GridFormat {
  * \brief Reader for .vtp file format
  */
 class VTPReader : public GridReader {
+ public:
+    VTPReader() = default;
+    explicit VTPReader(VTK::XMLReaderOptions opts)
+    : _xml_opts{std::move(opts)}
+    {}
+
  private:
     void _open(const std::string& filename, typename GridReader::FieldNames& fields) override {
-        auto helper = VTK::XMLReaderHelper::make_from(filename, "PolyData");
+        auto helper = VTK::XMLReaderHelper::make_from(filename, "PolyData", _xml_opts);
 
         _num_points = from_string<std::size_t>(helper.get("PolyData/Piece").get_attribute("NumberOfPoints"));
         _num_verts = helper.get("PolyData/Piece").get_attribute_or(std::size_t{0}, "NumberOfVerts");
@@ -130,6 +136,7 @@ class VTPReader : public GridReader {
         }
     }
 
+    VTK::XMLReaderOptions _xml_opts;
     std::optional<VTK::XMLReaderHelper> _helper;
     std::size_t _num_points;
     std::size_t _num_verts;
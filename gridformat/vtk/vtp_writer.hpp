@@ -11,6 +11,7 @@
 #include <ranges>
 #include <ostream>
 #include <iostream>
+#include <optional>
 #include <algorithm>
 #include <functional>
 
@@ -124,26 +125,34 @@ class VTPWriter : public VTK::XMLWriterBase<Grid, VTPWriter<Grid>> {
             this->_set_data_array(context, "Piece/CellData", name, vtk_cell_fields.get(name));
         });
 
-        const FieldPtr coords_field = std::visit([&] <typename T> (const Precision<T>&) {
-            return VTK::make_coordinates_field<T>(this->grid(), false);
-        }, this->_xml_settings.coordinate_precision);
-        this->_set_data_array(context, "Piece/Points", "Coordinates", *coords_field);
-
-        const auto point_id_map = make_point_id_map(this->grid());
-        const auto verts_connectivity_field = _make_connectivity_field(verts_range, point_id_map);
-        const auto verts_offsets_field = _make_offsets_field(verts_range);
-        this->_set_data_array(context, "Piece/Verts", "connectivity", *verts_connectivity_field);
-        this->_set_data_array(context, "Piece/Verts", "offsets", *verts_offsets_field);
-
-        const auto lines_connectivity_field = _make_connectivity_field(lines_range, point_id_map);
-        const auto lines_offsets_field = _make_offsets_field(lines_range);
-        this->_set_data_array(context, "Piece/Lines", "connectivity", *lines_connectivity_field);
-        this->_set_data_array(context, "Piece/Lines", "offsets", *lines_offsets_field);
-
-        const auto polys_connectivity_field = _make_connectivity_field(polys_range, point_id_map);
-        const auto polys_offsets_field = _make_offsets_field(polys_range);
-        this->_set_data_array(context, "Piece/Polys", "connectivity", *polys_connectivity_field);
-        this->_set_data_array(context, "Piece/Polys", "offsets", *polys_offsets_field);
+        // the grid fields must outlive the call below, as they are only serialized in _write_xml
+        std::optional<PointIdMap> point_id_map;
+        FieldPtr coords_field;
+        FieldPtr verts_connectivity_field, verts_offsets_field;
+        FieldPtr lines_connectivity_field, lines_offsets_field;
+        FieldPtr polys_connectivity_field, polys_offsets_field;
+        this->_set_grid_data_arrays(context, [&] (auto& grid_context) {
+            coords_field = std::visit([&] <typename T> (const Precision<T>&) {
+                return VTK::make_coordinates_field<T>(this->grid(), false);
+            }, this->_xml_settings.coordinate_precision);
+            this->_set_data_array(grid_context, "Piece/Points", "Coordinates", *coords_field);
+
+            point_id_map.emplace(make_point_id_map(this->grid()));
+            verts_connectivity_field = _make_connectivity_field(verts_range, *point_id_map);
+            verts_offsets_field = _make_offsets_field(verts_range);
+            this->_set_data_array(grid_context, "Piece/Verts", "connectivity", *verts_connectivity_field);
+            this->_set_data_array(grid_context, "Piece/Verts", "offsets", *verts_offsets_field);
+
+            lines_connectivity_field = _make_connectivity_field(lines_range, *point_id_map);
+            lines_offsets_field = _make_offsets_field(lines_range);
+            this->_set_data_array(grid_context, "Piece/Lines", "connectivity", *lines_connectivity_field);
+            this->_set_data_array(grid_context, "Piece/Lines", "offsets", *lines_offsets_field);
+
+            polys_connectivity_field = _make_connectivity_field(polys_range, *point_id_map);
+            polys_offsets_field = _make_offsets_field(polys_range);
+            this->_set_data_array(grid_context, "Piece/Polys", "connectivity", *polys_connectivity_field);
+            this->_set_data_array(grid_context, "Piece/Polys", "offsets", *polys_offsets_field);
+        });
 
         this->_write_xml(std::move(context), s);
     }
@@ -30,9 +30,15 @@ namespace GridFormat {
  * \brief Reader for .vtr file format
  */
 class VTRReader : public GridReader {
+ public:
+    VTRReader() = default;
+    explicit VTRReader(VTK::XMLReaderOptions opts)
+    : _xml_opts{std::move(opts)}
+    {}
+
  private:
     void _open(const std::string& filename, typename GridReader::FieldNames& fields) override {
-        auto helper = VTK::XMLReaderHelper::make_from(filename, "RectilinearGrid");
+        auto helper = VTK::XMLReaderHelper::make_from(filename, "RectilinearGrid", _xml_opts);
         _extents = Ranges::array_from_string<std::size_t, 6>(helper.get("RectilinearGrid/Piece").get_attribute("Extent"));
         VTK::XMLDetail::copy_field_names_from(helper.get("RectilinearGrid"), fields);
         _helper.emplace(std::move(helper));
@@ -161,6 +167,7 @@ class VTRReader : public GridReader {
         return result;
     }
 
+    VTK::XMLReaderOptions _xml_opts;
     std::optional<VTK::XMLReaderHelper> _helper;
     std::optional<std::array<std::size_t, 6>> _extents;
 };
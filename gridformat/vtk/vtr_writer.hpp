@@ -85,9 +85,12 @@ class VTRWriter : public VTK::XMLWriterBase<Grid, VTRWriter<Grid>> {
             this->_set_data_array(context, "Piece/CellData", name, vtk_cell_fields.get(name));
         });
 
-        const auto coord_fields = _make_ordinate_fields();
-        for (unsigned dir = 0; dir < space_dim; ++dir)
-            this->_set_data_array(context, "Piece/Coordinates", "X_" + std::to_string(dir), *coord_fields[dir]);
+        std::array<FieldPtr, space_dim> coord_fields;
+        this->_set_grid_data_arrays(context, [&] (auto& grid_context) {
+            coord_fields = _make_ordinate_fields();
+            for (unsigned dir = 0; dir < space_dim; ++dir)
+                this->_set_data_array(grid_context, "Piece/Coordinates", "X_" + std::to_string(dir), *coord_fields[dir]);
+        });
         this->_write_xml(std::move(context), s);
     }
 
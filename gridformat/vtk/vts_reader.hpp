@@ -11,6 +11,7 @@
 #include <string>
 #include <optional>
 #include <array>
+#include <utility>
 
 #include <gridformat/common/ranges.hpp>
 #include <gridformat/common/field.hpp>
@@ -26,9 +27,15 @@ namespace GridFormat {
  * \brief Reader for .vts file format
  */
 class VTSReader : public GridReader {
+ public:
+    VTSReader() = default;
+    explicit VTSReader(VTK::XMLReaderOptions opts)
+    : _xml_opts{std::move(opts)}
+    {}
+
  private:
     void _open(const std::string& filename, typename GridReader::FieldNames& fields) override {
-        auto helper = VTK::XMLReaderHelper::make_from(filename, "StructuredGrid");
+        auto helper = VTK::XMLReaderHelper::make_from(filename, "StructuredGrid", _xml_opts);
         _extents = Ranges::array_from_string<std::size_t, 6>(helper.get("StructuredGrid/Piece").get_attribute("Extent"));
         VTK::XMLDetail::copy_field_names_from(helper.get("StructuredGrid"), fields);
         _helper.emplace(std::move(helper));
@@ -91,6 +98,7 @@ class VTSReader : public GridReader {
         return _helper.value().make_data_array_field(name, "StructuredGrid/FieldData");
     }
 
+    VTK::XMLReaderOptions _xml_opts;
     std::optional<VTK::XMLReaderHelper> _helper;
     std::optional<std::array<std::size_t, 6>> _extents;
 };
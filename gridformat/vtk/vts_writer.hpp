@@ -84,10 +84,13 @@ class VTSWriter : public VTK::XMLWriterBase<Grid, VTSWriter<Grid>> {
             this->_set_data_array(context, "Piece/CellData", name, vtk_cell_fields.get(name));
         });
 
-        const FieldPtr coords_field = std::visit([&] <typename T> (const Precision<T>&) {
-            return VTK::make_coordinates_field<T>(this->grid(), true);
-        }, this->_xml_settings.coordinate_precision);
-        this->_set_data_array(context, "Piece/Points", "Coordinates", *coords_field);
+        FieldPtr coords_field;
+        this->_set_grid_data_arrays(context, [&] (auto& grid_context) {
+            coords_field = std::visit([&] <typename T> (const Precision<T>&) {
+                return VTK::make_coordinates_field<T>(this->grid(), true);
+            }, this->_xml_settings.coordinate_precision);
+            this->_set_data_array(grid_context, "Piece/Points", "Coordinates", *coords_field);
+        });
 
         this->_write_xml(std::move(context), s);
     }
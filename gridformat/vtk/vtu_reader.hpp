@@ -27,9 +27,15 @@ namespace GridFormat {
  * \brief Reader for .vtu file format
  */
 class VTUReader : public GridReader {
+ public:
+    VTUReader() = default;
+    explicit VTUReader(VTK::XMLReaderOptions opts)
+    : _xml_opts{std::move(opts)}
+    {}
+
  private:
     void _open(const std::string& filename, typename GridReader::FieldNames& fields) override {
-        auto helper = VTK::XMLReaderHelper::make_from(filename, "UnstructuredGrid");
+        auto helper = VTK::XMLReaderHelper::make_from(filename, "UnstructuredGrid", _xml_opts);
 
         _num_points = from_string<std::size_t>(helper.get("UnstructuredGrid/Piece").get_attribute("NumberOfPoints"));
         _num_cells = from_string<std::size_t>(helper.get("UnstructuredGrid/Piece").get_attribute("NumberOfCells"));
@@ -103,6 +109,7 @@ class VTUReader : public GridReader {
         return _helper.value().make_data_array_field(name, "UnstructuredGrid/FieldData");
     }
 
+    VTK::XMLReaderOptions _xml_opts;
     std::optional<VTK::XMLReaderHelper> _helper;
     std::size_t _num_points;
     std::size_t _num_cells;
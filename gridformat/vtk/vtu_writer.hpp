@@ -11,6 +11,7 @@
 #include <ranges>
 #include <ostream>
 #include <string>
+#include <optional>
 
 #include <gridformat/common/field.hpp>
 #include <gridformat/common/field_storage.hpp>
@@ -57,21 +58,26 @@ class VTUWriter : public VTK::XMLWriterBase<Grid, VTUWriter<Grid>> {
             this->_set_data_array(context, "Piece/CellData", name, vtk_cell_fields.get(name));
         });
 
-        const auto point_id_map = make_point_id_map(this->grid());
-        const FieldPtr coords_field = std::visit([&] <typename T> (const Precision<T>&) {
-            return VTK::make_coordinates_field<T>(this->grid(), false);
-        }, this->_xml_settings.coordinate_precision);
-        const FieldPtr connectivity_field = std::visit([&] <typename T> (const Precision<T>&) {
-            return VTK::make_connectivity_field<T>(this->grid(), point_id_map);
-        }, this->_xml_settings.header_precision);
-        const FieldPtr offsets_field = std::visit([&] <typename T> (const Precision<T>&) {
-            return VTK::make_offsets_field<T>(this->grid());
-        }, this->_xml_settings.header_precision);
-        const FieldPtr types_field = VTK::make_cell_types_field(this->grid());
-        this->_set_data_array(context, "Piece/Points", "Coordinates", *coords_field);
-        this->_set_data_array(context, "Piece/Cells", "connectivity", *connectivity_field);
-        this->_set_data_array(context, "Piece/Cells", "offsets", *offsets_field);
-        this->_set_data_array(context, "Piece/Cells", "types", *types_field);
+        // the grid fields must outlive the call below, as they are only serialized in _write_xml
+        std::optional<PointIdMap> point_id_map;
+        FieldPtr coords_field, connectivity_field, offsets_field, types_field;
+        this->_set_grid_data_arrays(context, [&] (auto& grid_context) {
+            point_id_map.emplace(make_point_id_map(this->grid()));
+            coords_field = std::visit([&] <typename T> (const Precision<T>&) {
+                return VTK::make_coordinates_field<T>(this->grid(), false);
+            }, this->_xml_settings.coordinate_precision);
+            connectivity_field = std::visit([&] <typename T> (const Precision<T>&) {
+                return VTK::make_connectivity_field<T>(this->grid(), *point_id_map);
+            }, this->_xml_settings.header_precision);
+            offsets_field = std::visit([&] <typename T> (const Precision<T>&) {
+                return VTK::make_offsets_field<T>(this->grid());
+            }, this->_xml_settings.header_precision);
+            types_field = VTK::make_cell_types_field(this->grid());
+            this->_set_data_array(grid_context, "Piece/Points", "Coordinates", *coords_field);
+            this->_set_data_array(grid_context, "Piece/Cells", "connectivity", *connectivity_field);
+            this->_set_data_array(grid_context, "Piece/Cells", "offsets", *offsets_field);
+            this->_set_data_array(grid_context, "Piece/Cells", "types", *types_field);
+        });
         this->_write_xml(std::move(context), s);
     }
 };
@@ -10,6 +10,11 @@
 
 #include <bit>
 #include <string>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <sstream>
+#include <unordered_map>
 #include <ranges>
 #include <utility>
 #include <type_traits>
@@ -29,7 +34,12 @@
 #include <gridformat/common/logging.hpp>
 #include <gridformat/common/field.hpp>
 #include <gridformat/common/lazy_field.hpp>
+#include <gridformat/common/field_cache.hpp>
 #include <gridformat/common/path.hpp>
+#include <gridformat/common/mapped_file.hpp>
+#include <gridformat/common/span_stream.hpp>
+#include <gridformat/common/read_ahead_stream.hpp>
+#include <gridformat/common/threading.hpp>
 
 #include <gridformat/encoding/base64.hpp>
 #include <gridformat/encoding/ascii.hpp>
@@ -94,7 +104,11 @@ using DefaultCompressor = std::variant_alternative_t<0, XMLDetail::Compressor>;
  *
  *          Note that these compressors are only available if the respective libraries were found.
  *          All options can also be set to GridFormat::automatic, in which case a suitable option
- *          is chosen.
+ *          is chosen. If more than one thread is used, the (encoded) data arrays are prepared
+ *          concurrently in memory before they are written to the output in order. If the grid is
+ *          marked as static, the output of the data arrays describing the grid (e.g. coordinates
+ *          and connectivity) is computed on the first write and reused verbatim in later writes
+ *          of the same writer, which is useful for time series on a fixed grid.
  */
 struct XMLOptions {
     using EncoderOption = ExtendedVariant<XML::Encoder, Automatic>;
@@ -106,6 +120,9 @@ struct XMLOptions {
     DataFormatOption data_format = automatic;
     CoordinatePrecisionOption coordinate_precision = automatic;
     XML::HeaderPrecision header_precision = _from_size_t();
+    std::size_t num_threads = 1;  //!< Number of threads used for preparing data arrays (0 = all available)
+    bool static_grid = false;     //!< Set to true if the grid does not change between writes (grid arrays are then encoded only once)
+    std::size_t ranks_per_piece = 1;  //!< Number of processes whose data is written into one piece file in parallel output (only .pvtu)
 
  private:
     static constexpr XML::HeaderPrecision _from_size_t() {
@@ -172,6 +189,80 @@ namespace XMLDetail {
         }
     };
 
+    //! Interface for data arrays whose output can be prepared in memory ahead of writing
+    struct PreparableDataArray {
+        virtual ~PreparableDataArray() = default;
+        virtual void prepare() = 0;
+    };
+
+    //! Streamable handle to a data array that writes the prepared output if available
+    template<typename DataArray>
+    class PreparedDataArray {
+        struct State : public PreparableDataArray {
+            explicit State(DataArray&& arr) : data_array{std::move(arr)} {}
+
+            void prepare() override {
+                std::ostringstream s;
+                s << data_array;
+                output = std::move(s).str();
+            }
+
+            DataArray data_array;
+            std::optional<std::string> output;
+        };
+
+     public:
+        explicit PreparedDataArray(DataArray&& arr)
+        : _state{std::make_shared<State>(std::move(arr))}
+        {}
+
+        std::shared_ptr<PreparableDataArray> preparable() const {
+            return _state;
+        }
+
+        friend std::ostream& operator<<(std::ostream& s, const PreparedDataArray& arr) {
+            if (arr._state->output)
+                s.write(arr._state->output->data(), arr._state->output->size());
+            else
+                s << arr._state->data_array;
+            return s;
+        }
+
+     private:
+        std::shared_ptr<State> _state;
+    };
+
+    //! Streamable data array with output that was computed before
+    class CachedDataArray {
+     public:
+        explicit CachedDataArray(std::shared_ptr<const std::string> output)
+        : _output{std::move(output)}
+        {}
+
+        friend std::ostream& operator<<(std::ostream& s, const CachedDataArray& arr) {
+            s.write(arr._output->data(), arr._output->size());
+            return s;
+        }
+
+     private:
+        std::shared_ptr<const std::string> _output;
+    };
+
+    //! Stores the data arrays describing a static grid for reuse in subsequent writes
+    struct GridArrayCache {
+        struct Entry {
+            std::string xml_group;
+            std::string name;
+            std::string type;
+            std::size_t number_of_components;
+            std::string format;
+            std::shared_ptr<const std::string> output;
+        };
+
+        bool is_filled = false;
+        std::vector<Entry> entries = {};
+    };
+
 }  // namespace XMLDetail
 #endif  // DOXYGEN
 
@@ -199,6 +290,7 @@ class XMLWriterBase
     : ParentType(grid, std::move(extension), WriterOptions{use_structured_grid_ordering, true})
     , _xml_opts{std::move(xml_opts)}
     , _xml_settings{XMLDetail::XMLSettings::from<GridCoordinateType>(_xml_opts)}
+    , _grid_array_cache{_xml_opts.static_grid ? std::make_shared<XMLDetail::GridArrayCache>() : nullptr}
     {}
 
     XMLWriterBase() = default;
@@ -243,19 +335,78 @@ class XMLWriterBase
         return with(std::move(opts));
     }
 
+    //! Return a writer that prepares the data arrays on the given number of threads (0 = all available)
+    Impl with_threads(std::size_t num_threads) const {
+        auto opts = _xml_opts;
+        opts.num_threads = num_threads;
+        return with(std::move(opts));
+    }
+
+    //! Return a writer that encodes the grid arrays only once and reuses them in subsequent writes
+    Impl with_static_grid(bool value = true) const {
+        auto opts = _xml_opts;
+        opts.static_grid = value;
+        return with(std::move(opts));
+    }
+
  private:
+    template<Concepts::Grid, typename> friend class XMLWriterBase;
     virtual Impl _with(XMLOptions opts) const = 0;
 
  protected:
     XMLOptions _xml_opts;
     XMLDetail::XMLSettings _xml_settings;
+    std::shared_ptr<XMLDetail::GridArrayCache> _grid_array_cache;
 
     struct WriteContext {
         std::string vtk_grid_type;
         XMLElement xml_representation;
         Appendix appendix;
+        std::vector<std::shared_ptr<XMLDetail::PreparableDataArray>> data_arrays = {};
+        XMLDetail::GridArrayCache* grid_array_cache = nullptr;  // set while grid arrays are to be cached
     };
 
+    //! Let the given (piece) writer use the same cache for the grid arrays as this writer
+    template<typename Writer>
+    void _share_grid_array_cache_with(Writer& writer) const {
+        using Base = XMLWriterBase<typename Writer::Grid, Writer>;
+        static_cast<Base&>(writer)._grid_array_cache = _grid_array_cache;
+    }
+
+    /*!
+     * \brief Set the data arrays describing the grid via the given action.
+     * \details If the grid is static, the output of the data arrays set by the action on the
+     *          first write is stored, and in subsequent writes, the action is not invoked and the
+     *          stored output is reused instead.
+     */
+    template<std::invocable<WriteContext&> Action>
+    void _set_grid_data_arrays(WriteContext& context, const Action& set_arrays) const {
+        if (!_grid_array_cache) {
+            set_arrays(context);
+            return;
+        }
+
+        if (_grid_array_cache->is_filled) {
+            for (const auto& entry : _grid_array_cache->entries) {
+                XMLElement& da = _access_at(entry.xml_group, context).add_child("DataArray");
+                da.set_attribute("Name", entry.name);
+                da.set_attribute("type", entry.type);
+                da.set_attribute("NumberOfComponents", entry.number_of_components);
+                da.set_attribute("format", entry.format);
+                std::visit([&] (const auto& data_format) {
+                    _set_data_array_content(data_format, da, context.appendix, XMLDetail::CachedDataArray{entry.output});
+                }, _xml_settings.data_format);
+            }
+            return;
+        }
+
+        _grid_array_cache->entries.clear();
+        context.grid_array_cache = _grid_array_cache.get();
+        set_arrays(context);
+        context.grid_array_cache = nullptr;
+        _grid_array_cache->is_filled = true;
+    }
+
     WriteContext _get_write_context(std::string vtk_grid_type) const {
         return std::visit([&] (const auto& compressor) {
             return std::visit([&] (const auto& header_precision) {
@@ -310,7 +461,7 @@ class XMLWriterBase
                                 );
                             }
                             DataArray content{field, encoder, compressor, header_precision};
-                            _set_data_array_content(data_format, array, context.appendix, std::move(content));
+                            _set_data_array_content(data_format, array, context, std::move(content));
                         });
                     }, _xml_settings.header_precision);
                 }, _xml_settings.data_format);
@@ -331,34 +482,64 @@ class XMLWriterBase
                          std::string data_array_name,
                          const Field& field) const {
         const auto layout = field.layout();
+        const std::size_t number_of_components = layout.dimension() == 1 ? 1 : layout.number_of_entries(1);
         XMLElement& da = _access_at(xml_group, context).add_child("DataArray");
-        da.set_attribute("Name", std::move(data_array_name));
+        da.set_attribute("Name", data_array_name);
         da.set_attribute("type", attribute_name(field.precision()));
-        da.set_attribute("NumberOfComponents", (layout.dimension() == 1 ? 1 : layout.number_of_entries(1)));
+        da.set_attribute("NumberOfComponents", number_of_components);
         std::visit([&] (const auto& encoder) {
             std::visit([&] (const auto& compressor) {
                 std::visit([&] (const auto& data_format) {
                     std::visit([&] (const auto& header_prec) {
                         da.set_attribute("format", data_format_name(encoder, data_format));
                         DataArray content{field, encoder, compressor, header_prec};
-                        _set_data_array_content(data_format, da, context.appendix, std::move(content));
+                        if (context.grid_array_cache) {
+                            std::ostringstream output;
+                            output << content;
+                            context.grid_array_cache->entries.push_back({
+                                .xml_group = std::string{xml_group},
+                                .name = std::move(data_array_name),
+                                .type = attribute_name(field.precision()),
+                                .number_of_components = number_of_components,
+                                .format = data_format_name(encoder, data_format),
+                                .output = std::make_shared<const std::string>(std::move(output).str())
+                            });
+                            XMLDetail::CachedDataArray cached{context.grid_array_cache->entries.back().output};
+                            _set_data_array_content(data_format, da, context.appendix, std::move(cached));
+                        } else {
+                            _set_data_array_content(data_format, da, context, std::move(content));
+                        }
                     }, _xml_settings.header_precision);
                 }, _xml_settings.data_format);
             }, _xml_settings.compressor);
         }, _xml_settings.encoder);
     }
 
-    template<typename DataFormat, typename Appendix, typename Content>
+    template<typename DataFormat, typename Content>
         requires(!std::is_lvalue_reference_v<Content>)
-    void _set_data_array_content(const DataFormat&,
+    void _set_data_array_content(const DataFormat& format,
                                  XMLElement& e,
-                                 Appendix& app,
+                                 WriteContext& context,
                                  Content&& c) const {
         static constexpr bool is_inlined = std::is_same_v<DataFormat, VTK::DataFormat::Inlined>;
         static constexpr bool is_appended = std::is_same_v<DataFormat, VTK::DataFormat::Appended>;
         static_assert(is_inlined || is_appended, "Unknown data format");
 
-        if constexpr (is_inlined)
+        if (_xml_opts.num_threads != 1) {
+            XMLDetail::PreparedDataArray prepared{std::move(c)};
+            context.data_arrays.push_back(prepared.preparable());
+            _set_data_array_content(format, e, context.appendix, std::move(prepared));
+        } else {
+            _set_data_array_content(format, e, context.appendix, std::move(c));
+        }
+    }
+
+    template<typename DataFormat, typename Content>
+    void _set_data_array_content(const DataFormat&,
+                                 XMLElement& e,
+                                 Appendix& app,
+                                 Content&& c) const {
+        if constexpr (std::is_same_v<DataFormat, VTK::DataFormat::Inlined>)
             e.set_content(std::move(c));
         else
             app.add(std::move(c));
@@ -369,6 +550,10 @@ class XMLWriterBase
     }
 
     void _write_xml(WriteContext&& context, std::ostream& s) const {
+        Threading::parallel_for(context.data_arrays.size(), _xml_opts.num_threads, [&] (std::size_t i) {
+            context.data_arrays[i]->prepare();
+        });
+
         Indentation indentation{{.width = 2}};
         _set_default_active_fields(context.xml_representation.get_child(context.vtk_grid_type));
         std::visit([&] (const auto& encoder) {
@@ -433,6 +618,65 @@ namespace XMLDetail {
         helper.shift_by(offset_in_appendix);
     }
 
+    /*!
+     * \brief Input context shared by a reader and the lazy fields it creates.
+     * \details Keeps the file open (or mapped into memory) for the lifetime of the reader and its fields,
+     *          and caches the headers of data arrays. File streams read ahead in large windows, such that
+     *          accessing data arrays in file order requires only few reads from the file. Access to the
+     *          file stream is serialized, while streams over the mapped file can be used concurrently.
+     */
+    class InputContext {
+     public:
+        using Header = std::vector<std::size_t>;
+
+        InputContext(const std::string& filename, bool memory_map)
+        : _mapping{memory_map ? std::make_unique<const MappedFile>(filename) : nullptr} {
+            if (_mapping)
+                _stream = std::make_unique<SpanInputStream>(_mapping->data());
+            else
+                _stream = std::make_unique<ReadAheadFileStream>(filename);
+        }
+
+        //! Return the stream for sequential access (e.g. to parse the file)
+        std::istream& stream() {
+            return *_stream;
+        }
+
+        //! Invoke the given action with a stream on the file
+        template<std::invocable<std::istream&> Action>
+        decltype(auto) with_stream(const Action& action) {
+            if (_mapping) {
+                SpanInputStream stream{_mapping->data()};
+                return action(static_cast<std::istream&>(stream));
+            }
+
+            std::lock_guard lock{_stream_mutex};
+            _stream->clear();
+            return action(*_stream);
+        }
+
+        //! Return the cached header of the data array at the given position (or invoke the given function to read it)
+        template<std::invocable Reader>
+        Header header_at(std::streamsize position, const Reader& read_header) {
+            {
+                std::lock_guard lock{_headers_mutex};
+                if (auto it = _headers.find(position); it != _headers.end())
+                    return it->second;
+            }
+            Header header = read_header();
+            std::lock_guard lock{_headers_mutex};
+            _headers.try_emplace(position, header);
+            return header;
+        }
+
+     private:
+        std::unique_ptr<const MappedFile> _mapping;
+        std::unique_ptr<std::istream> _stream;
+        std::mutex _stream_mutex;
+        std::unordered_map<std::streamsize, Header> _headers;
+        std::mutex _headers_mutex;
+    };
+
     void _move_to_data(const DataArrayStreamLocation& location, std::istream& s) {
         if (location.offset)
             _move_to_appendix_position(s, location.begin, location.offset.value());
@@ -443,25 +687,25 @@ namespace XMLDetail {
         }
     }
 
-    template<typename HeaderType>
-    void _decompress_with(const std::string& vtk_compressor,
-                         [[maybe_unused]] Serialization& data,
-                         [[maybe_unused]] const Compression::CompressedBlocks<HeaderType>& blocks) {
+    template<typename Action>
+    void _visit_decompressor(const std::string& vtk_compressor,
+                             [[maybe_unused]] std::size_t num_threads,
+                             [[maybe_unused]] const Action& action) {
         if (vtk_compressor == "vtkLZ4DataCompressor") {
 #if GRIDFORMAT_HAVE_LZ4
-            LZ4Compressor{}.decompress(data, blocks);
+            action(LZ4Compressor{{.num_threads = num_threads}});
 #else
             throw InvalidState("Need LZ4 to decompress the data");
 #endif
         } else if (vtk_compressor == "vtkLZMADataCompressor") {
 #if GRIDFORMAT_HAVE_LZMA
-            LZMACompressor{}.decompress(data, blocks);
+            action(LZMACompressor{{.num_threads = num_threads}});
 #else
             throw InvalidState("Need LZMA to decompress the data");
 #endif
         } else if (vtk_compressor == "vtkZLibDataCompressor") {
 #if GRIDFORMAT_HAVE_ZLIB
-            ZLIBCompressor{}.decompress(data, blocks);
+            action(ZLIBCompressor{{.num_threads = num_threads}});
 #else
             throw InvalidState("Need ZLib to decompress the data");
 #endif
@@ -470,42 +714,51 @@ namespace XMLDetail {
         }
     }
 
+    template<typename HeaderType>
+    void _decompress_with(const std::string& vtk_compressor,
+                          Serialization& data,
+                          const Compression::CompressedBlocks<HeaderType>& blocks,
+                          std::size_t num_threads = 1) {
+        _visit_decompressor(vtk_compressor, num_threads, [&] (const auto& compressor) {
+            compressor.decompress(data, blocks);
+        });
+    }
+
+    template<typename HeaderType>
+    void _decompress_into_with(const std::string& vtk_compressor,
+                               std::span<const std::byte> data,
+                               const Compression::CompressedBlocks<HeaderType>& blocks,
+                               std::span<std::byte> out,
+                               std::size_t num_threads = 1) {
+        _visit_decompressor(vtk_compressor, num_threads, [&] (const auto& compressor) {
+            compressor.decompress_into(data, blocks, out);
+        });
+    }
+
     template<Concepts::Scalar TargetType, Concepts::Scalar HeaderType = std::size_t>
     class DataArrayReader {
         static constexpr Precision<TargetType> target_precision{};
         static constexpr Precision<HeaderType> header_precision{};
 
-        static constexpr bool is_too_small_integral = std::integral<TargetType> && sizeof(TargetType) < 4;
-        static constexpr bool is_signed_integral = std::signed_integral<TargetType>;
-        using BufferedType = std::conditional_t<is_signed_integral, short, unsigned short>;
-
      public:
         using Header = std::vector<HeaderType>;
 
         DataArrayReader(std::istream& s,
                         std::endian e = std::endian::native,
-                        std::string compressor = "")
+                        std::string compressor = "",
+                        std::size_t num_threads = 1)
         : _stream{s}
         , _endian{e}
         , _compressor{compressor}
+        , _num_threads{num_threads}
         {}
 
         void read_ascii(std::size_t number_of_values, Serialization& out_values) {
             out_values.resize(number_of_values*sizeof(TargetType));
             std::span<TargetType> out_span = out_values.as_span_of(target_precision);
-
-            // istream_view uses operator>>, which seems to do weird stuff for e.g. uint8_t.
-            // The smallest supported integral type seems to be short. In case we deal with
-            // small integral types, we first read into a vector and then cast into the desired type.
-            if constexpr (is_too_small_integral) {
-                std::vector<BufferedType> buffer(number_of_values);
-                _read_ascii_to(std::span{buffer}, number_of_values);
-                std::ranges::copy(buffer | std::views::transform([] <typename T> (const T& value) {
-                    return static_cast<TargetType>(value);
-                }), out_span.begin());
-            } else {
-                _read_ascii_to(out_span, number_of_values);
-            }
+            const AsciiDecoder decoder{{.num_threads = _num_threads}};
+            if (decoder.decode_from(_stream, out_span) < number_of_values)
+                throw SizeError("Could not read the requested number of values from the stream");
         }
 
         template<Concepts::Decoder Decoder>
@@ -522,19 +775,57 @@ namespace XMLDetail {
             }
         }
 
-     private:
-        template<typename T, std::size_t size>
-        void _read_ascii_to(std::span<T, size> buffer, std::size_t expected_num_values) const {
-            const auto [_, out] = std::ranges::copy(
-                std::ranges::istream_view<T>{_stream}
-                | std::views::take(expected_num_values),
-                buffer.begin()
-            );
-            const auto number_of_values_read = std::ranges::distance(buffer.begin(), out);
-            if (number_of_values_read < 0 || static_cast<std::size_t>(number_of_values_read) < expected_num_values)
-                throw SizeError("Could not read the requested number of values from the stream");
+        //! Read only the bytes [offset, offset + size) of the values (decompresses only the affected blocks)
+        template<Concepts::Decoder Decoder>
+        void read_binary_range(const Decoder& decoder,
+                               std::size_t offset,
+                               std::size_t size,
+                               Serialization& out_values) {
+            if constexpr (std::unsigned_integral<HeaderType> && sizeof(HeaderType) >= 4) {
+                if (_compressor.empty())
+                    _read_encoded_range(decoder, offset, size, out_values);
+                else
+                    _read_encoded_compressed_range(decoder, offset, size, out_values);
+                change_byte_order(out_values.as_span_of(target_precision), {.from = _endian});
+            } else {
+                throw IOError("Unsupported header type");
+            }
+        }
+
+        /*!
+         * \brief Read the values directly into the given buffer, whose size must match the number of bytes of the values.
+         * \note Only the compressed data (if any) is read into an intermediate buffer.
+         */
+        template<Concepts::Decoder Decoder>
+        void read_binary_into(const Decoder& decoder, std::span<std::byte> out_values) {
+            if constexpr (std::unsigned_integral<HeaderType> && sizeof(HeaderType) >= 4) {
+                if (_compressor.empty())
+                    _read_encoded_into(decoder, out_values);
+                else
+                    _read_encoded_compressed_into(decoder, out_values);
+                change_byte_order(std::span{
+                    reinterpret_cast<TargetType*>(out_values.data()),
+                    out_values.size()/sizeof(TargetType)
+                }, {.from = _endian});
+            } else {
+                throw IOError("Unsupported header type");
+            }
         }
 
+     private:
+        struct CompressionHeader {
+            HeaderType number_of_blocks;
+            HeaderType full_block_size;
+            HeaderType residual_block_size;
+            std::vector<HeaderType> compressed_block_sizes;
+
+            HeaderType number_of_raw_bytes() const {
+                return residual_block_size > 0
+                    ? full_block_size*(number_of_blocks-1) + residual_block_size
+                    : full_block_size*number_of_blocks;
+            }
+        };
+
         template<typename Decoder>
         void _read_encoded(const Decoder& decoder,
                            OptionalReference<Header> out_header = {},
@@ -580,6 +871,129 @@ namespace XMLDetail {
         void _read_encoded_compressed(const Decoder& decoder,
                                       OptionalReference<Header> out_header = {},
                                       OptionalReference<Serialization> out_values = {}) {
+            CompressionHeader header = _read_compression_header(decoder);
+            if (out_header) {
+                out_header.unwrap().push_back(header.number_of_blocks);
+                out_header.unwrap().push_back(header.full_block_size);
+                out_header.unwrap().push_back(header.residual_block_size);
+                std::ranges::copy(header.compressed_block_sizes, std::back_inserter(out_header.unwrap()));
+            }
+
+            if (out_values) {
+                Serialization& values = out_values.unwrap();
+                values = decoder.decode_from(_stream, std::accumulate(
+                    header.compressed_block_sizes.begin(),
+                    header.compressed_block_sizes.end(),
+                    HeaderType{0}
+                ));
+
+                _decompress_with(_compressor, values, Compression::CompressedBlocks{
+                    {header.number_of_raw_bytes(), header.full_block_size},
+                    std::move(header.compressed_block_sizes)
+                }, _num_threads);
+                change_byte_order(values.as_span_of(target_precision), {.from = _endian});
+            }
+        }
+
+        template<typename Decoder>
+        void _read_encoded_into(const Decoder& decoder, std::span<std::byte> out_values) {
+            const auto begin_pos = _stream.tellg();
+            Serialization header = decoder.decode_from(_stream, sizeof(HeaderType));
+            if (header.size() < sizeof(HeaderType))
+                throw SizeError("Could not read header");
+
+            const bool encoded_with_header = header.size() != sizeof(HeaderType);
+            header.resize(sizeof(HeaderType));
+            change_byte_order(header.as_span_of(header_precision), {.from = _endian});
+            _check_output_size(header.as_span_of(header_precision)[0], out_values.size());
+
+            if (encoded_with_header) {  // values do not start at the beginning of an encoded group
+                _stream.seekg(begin_pos);
+                const Serialization header_and_values = decoder.decode_from(_stream, sizeof(HeaderType) + out_values.size());
+                if (header_and_values.size() < sizeof(HeaderType) + out_values.size())
+                    throw SizeError("Could not read the requested number of values");
+                std::ranges::copy(header_and_values.as_span().subspan(sizeof(HeaderType), out_values.size()), out_values.begin());
+            } else {
+                decoder.decode_from(_stream, out_values);
+            }
+        }
+
+        template<typename Decoder>
+        void _read_encoded_compressed_into(const Decoder& decoder, std::span<std::byte> out_values) {
+            CompressionHeader header = _read_compression_header(decoder);
+            _check_output_size(header.number_of_raw_bytes(), out_values.size());
+            const Serialization compressed = decoder.decode_from(_stream, std::accumulate(
+                header.compressed_block_sizes.begin(),
+                header.compressed_block_sizes.end(),
+                std::size_t{0}
+            ));
+            _decompress_into_with(_compressor, compressed.as_span(), Compression::CompressedBlocks{
+                {header.number_of_raw_bytes(), header.full_block_size},
+                std::move(header.compressed_block_sizes)
+            }, out_values, _num_threads);
+        }
+
+        template<typename Decoder>
+        void _read_encoded_range(const Decoder& decoder,
+                                 std::size_t offset,
+                                 std::size_t size,
+                                 Serialization& out_values) {
+            const auto begin_pos = _stream.tellg();
+            Serialization header = decoder.decode_from(_stream, sizeof(HeaderType));
+            if (header.size() < sizeof(HeaderType))
+                throw SizeError("Could not read header");
+
+            // without padding, header & values are encoded together
+            const bool encoded_with_header = header.size() != sizeof(HeaderType);
+            header.resize(sizeof(HeaderType));
+            change_byte_order(header.as_span_of(header_precision), {.from = _endian});
+            _check_range(offset, size, header.as_span_of(header_precision)[0]);
+
+            out_values = encoded_with_header
+                ? _decode_range(decoder, begin_pos, sizeof(HeaderType) + offset, size)
+                : _decode_range(decoder, _stream.tellg(), offset, size);
+        }
+
+        template<typename Decoder>
+        void _read_encoded_compressed_range(const Decoder& decoder,
+                                            std::size_t offset,
+                                            std::size_t size,
+                                            Serialization& out_values) {
+            const CompressionHeader header = _read_compression_header(decoder);
+            const auto data_begin = _stream.tellg();
+            const std::size_t number_of_raw_bytes = header.number_of_raw_bytes();
+            _check_range(offset, size, number_of_raw_bytes);
+            if (size == 0) {
+                out_values.resize(0);
+                return;
+            }
+
+            // the compressed blocks overlapping with the range, and their position in the compressed data
+            const std::size_t block_size = header.full_block_size;
+            const auto& block_sizes = header.compressed_block_sizes;
+            const std::size_t first_block = offset/block_size;
+            const std::size_t end_block = (offset + size - 1)/block_size + 1;
+            const std::size_t compressed_offset = std::accumulate(
+                block_sizes.begin(), block_sizes.begin() + first_block, std::size_t{0}
+            );
+            std::vector<HeaderType> range_block_sizes{block_sizes.begin() + first_block, block_sizes.begin() + end_block};
+            const std::size_t compressed_size = std::accumulate(
+                range_block_sizes.begin(), range_block_sizes.end(), std::size_t{0}
+            );
+
+            const std::size_t raw_begin = first_block*block_size;
+            const std::size_t raw_end = std::min(end_block*block_size, number_of_raw_bytes);
+            out_values = _decode_range(decoder, data_begin, compressed_offset, compressed_size);
+            _decompress_with(_compressor, out_values, Compression::CompressedBlocks{
+                {static_cast<HeaderType>(raw_end - raw_begin), header.full_block_size},
+                std::move(range_block_sizes)
+            }, _num_threads);
+            out_values.cut_front(offset - raw_begin);
+            out_values.resize(size);
+        }
+
+        template<typename Decoder>
+        CompressionHeader _read_compression_header(const Decoder& decoder) {
             const auto begin_pos = _stream.tellg();
             const auto header_bytes = sizeof(HeaderType)*3;
             Serialization header = decoder.decode_from(_stream, header_bytes);
@@ -595,15 +1009,15 @@ namespace XMLDetail {
                 throw SizeError("Could not read data array header");
 
             change_byte_order(header_data, {.from = _endian});
-            const auto number_of_blocks = header_data[0];
-            const auto full_block_size = header_data[1];
-            const auto residual_block_size = header_data[2];
-            const HeaderType number_of_raw_bytes = residual_block_size > 0
-                ? full_block_size*(number_of_blocks-1) + residual_block_size
-                : full_block_size*number_of_blocks;
+            CompressionHeader result{
+                .number_of_blocks = header_data[0],
+                .full_block_size = header_data[1],
+                .residual_block_size = header_data[2],
+                .compressed_block_sizes = {}
+            };
 
             Serialization block_sizes;
-            const std::size_t block_sizes_bytes = sizeof(HeaderType)*number_of_blocks;
+            const std::size_t block_sizes_bytes = sizeof(HeaderType)*result.number_of_blocks;
             if (decode_blocks_with_header) {
                 _stream.seekg(begin_pos);
                 block_sizes = decoder.decode_from(_stream, header_bytes + block_sizes_bytes);
@@ -612,37 +1026,52 @@ namespace XMLDetail {
                 block_sizes = decoder.decode_from(_stream, block_sizes_bytes);
             }
 
-            std::vector<HeaderType> compressed_block_sizes(number_of_blocks);
+            result.compressed_block_sizes.resize(result.number_of_blocks);
             change_byte_order(block_sizes.as_span_of(header_precision), {.from = _endian});
             std::ranges::copy(
                 block_sizes.as_span_of(header_precision),
-                compressed_block_sizes.begin()
+                result.compressed_block_sizes.begin()
             );
+            return result;
+        }
 
-            if (out_header) {
-                std::ranges::copy(header_data, std::back_inserter(out_header.unwrap()));
-                std::ranges::copy(compressed_block_sizes, std::back_inserter(out_header.unwrap()));
-            }
+        // decode the bytes [offset, offset + size) of the data that is encoded beginning at the given position
+        template<typename Decoder>
+        Serialization _decode_range(const Decoder& decoder,
+                                    std::streampos data_begin,
+                                    std::size_t offset,
+                                    std::size_t size) {
+            const std::size_t first_group = offset/Decoder::decoded_group_size;
+            const std::size_t skipped_bytes = offset - first_group*Decoder::decoded_group_size;
+            _stream.seekg(data_begin + static_cast<std::streamoff>(first_group*Decoder::encoded_group_size));
+            Serialization result = decoder.decode_from(_stream, skipped_bytes + size);
+            if (result.size() < skipped_bytes + size)
+                throw SizeError("Could not read the requested range of values");
+            result.cut_front(skipped_bytes);
+            result.resize(size);
+            return result;
+        }
 
-            if (out_values) {
-                Serialization& values = out_values.unwrap();
-                values = decoder.decode_from(_stream, std::accumulate(
-                    compressed_block_sizes.begin(),
-                    compressed_block_sizes.end(),
-                    HeaderType{0}
-                ));
+        void _check_output_size(std::size_t number_of_bytes, std::size_t output_size) const {
+            if (number_of_bytes != output_size)
+                throw SizeError(
+                    "Number of bytes in the data array (" + std::to_string(number_of_bytes) + ") "
+                    + "does not match the size of the output buffer (" + std::to_string(output_size) + ")"
+                );
+        }
 
-                _decompress_with(_compressor, values, Compression::CompressedBlocks{
-                    {number_of_raw_bytes, full_block_size},
-                    std::move(compressed_block_sizes)
-                });
-                change_byte_order(values.as_span_of(target_precision), {.from = _endian});
-            }
+        void _check_range(std::size_t offset, std::size_t size, std::size_t number_of_bytes) const {
+            if (offset + size > number_of_bytes)
+                throw SizeError(
+                    "Requested range of bytes [" + std::to_string(offset) + ", " + std::to_string(offset + size) + ") "
+                    + "exceeds the size of the data array (" + std::to_string(number_of_bytes) + ")"
+                );
         }
 
         std::istream& _stream;
         std::endian _endian;
         std::string _compressor;
+        std::size_t _num_threads;
     };
 
 }  // namespace XMLDetail
@@ -719,6 +1148,16 @@ namespace XMLDetail {
 #endif  // DOXYGEN
 
 
+/*!
+ * \ingroup VTK
+ * \brief Options for VTK-XML readers.
+ */
+struct XMLReaderOptions {
+    std::size_t num_threads = 1;  //!< Number of threads used for decompressing or parsing data arrays (0 = all available)
+    bool memory_map = false;      //!< Read from a memory-mapped file instead of a file stream
+    std::shared_ptr<FieldCache> cache = nullptr;  //!< Cache for the data read from data arrays (optional, can be shared among readers)
+};
+
 /*!
  * \ingroup VTK
  * \brief Helper class for VTK-XML readers to use.
@@ -727,14 +1166,22 @@ class XMLReaderHelper {
     using DataArrayStreamLocation = XMLDetail::DataArrayStreamLocation;
 
  public:
-    explicit XMLReaderHelper(const std::string& filename)
+    explicit XMLReaderHelper(const std::string& filename, XMLReaderOptions opts = {})
     : _filename{filename}
-    , _parser{filename, "ROOT", [] (const XMLElement& e) { return e.name() == "AppendedData"; }} {
+    , _opts{std::move(opts)}
+    , _context{std::make_shared<XMLDetail::InputContext>(filename, _opts.memory_map)}
+    , _parser{
+        _context->stream(),
+        "ROOT",
+        [] (const XMLElement& e) { return e.name() == "AppendedData"; }
+    } {
         if (!_element().has_child("VTKFile"))
             throw IOError("Could not read " + filename + " as vtk-xml file. No root element <VTKFile> found.");
     }
 
-    static XMLReaderHelper make_from(const std::string& filename, std::string_view vtk_type) {
+    static XMLReaderHelper make_from(const std::string& filename,
+                                     std::string_view vtk_type,
+                                     XMLReaderOptions opts = {}) {
         if (!Path::exists(filename))
             throw IOError("File '" + filename + "' does not exist.");
         if (!Path::is_file(filename))
@@ -742,7 +1189,7 @@ class XMLReaderHelper {
 
         std::optional<XMLReaderHelper> helper;
         try {
-            helper.emplace(XMLReaderHelper{filename});
+            helper.emplace(XMLReaderHelper{filename, std::move(opts)});
         } catch (const std::exception& e) {
             throw IOError("Could not parse '" + filename + "' as xml file. Error: " + e.what());
         }
@@ -835,18 +1282,24 @@ class XMLReaderHelper {
         MDLayout expected_layout = _expected_layout(e, num_tuples);
         auto num_values = expected_layout.number_of_entries();
         return from_precision_attribute(e.get_attribute("type")).visit([&] <typename T> (const Precision<T>& prec) {
-            return make_field_ptr(LazyField{
-                std::string{_filename},
+            return _make_lazy_field(
+                _cache_key_for(e, num_values),
                 std::move(expected_layout),
                 prec,
-                [_nv=num_values, _begin=_parser.get_content_bounds(e).begin_pos] (std::string filename) {
-                    std::ifstream file{filename};
-                    file.seekg(_begin);
-                    Serialization result{_nv*sizeof(T)};
-                    XMLDetail::DataArrayReader<T>{file}.read_ascii(_nv, result);
-                    return result;
+                [
+                    _nv=num_values,
+                    _begin=_parser.get_content_bounds(e).begin_pos,
+                    _num_threads=_opts.num_threads,
+                    _context=_context
+                ] () {
+                    return _context->with_stream([&] (std::istream& file) {
+                        file.seekg(_begin);
+                        Serialization result{_nv*sizeof(T)};
+                        XMLDetail::DataArrayReader<T>{file, std::endian::native, "", _num_threads}.read_ascii(_nv, result);
+                        return result;
+                    });
                 }
-            });
+            );
         });
     }
 
@@ -855,31 +1308,109 @@ class XMLReaderHelper {
         return from_precision_attribute(e.get_attribute("type")).visit([&] <typename T> (const Precision<T>& prec) {
             FieldPtr result;
             _apply_decoder_for(e, [&] (auto&& decoder) {
-                result = make_field_ptr(LazyField{
-                    std::string{_filename},
-                    std::move(expected_layout),
-                    prec,
-                    [
-                        _loc=_stream_location_for(e),
-                        _header_prec=_header_precision(),
-                        _endian=from_endian_attribute(get().get_attribute("byte_order")),
-                        _comp=get().get_attribute_or(std::string{""}, "compressor"),
-                        _decoder=std::move(decoder)
-                    ] (std::string filename) {
-                        std::ifstream file{filename};
+                // writes the bytes [offset, offset + out.size()) of the values into the given buffer
+                auto read_into = [
+                    _loc=_stream_location_for(e),
+                    _header_prec=_header_precision(),
+                    _endian=from_endian_attribute(get().get_attribute("byte_order")),
+                    _comp=get().get_attribute_or(std::string{""}, "compressor"),
+                    _decoder=std::move(decoder),
+                    _num_bytes=expected_layout.number_of_entries()*sizeof(T),
+                    _num_threads=_opts.num_threads,
+                    _context=_context
+                ] (std::size_t offset, std::span<std::byte> out) {
+                    _context->with_stream([&] (std::istream& file) {
                         XMLDetail::_move_to_data(_loc, file);
-                        return _header_prec.visit([&] <typename H> (const Precision<H>&) {
-                            Serialization result;
-                            XMLDetail::DataArrayReader<T, H>{file, _endian, _comp}.read_binary(_decoder, {}, result);
-                            return result;
+                        _header_prec.visit([&] <typename H> (const Precision<H>&) {
+                            XMLDetail::DataArrayReader<T, H> reader{file, _endian, _comp, _num_threads};
+                            if (offset == 0 && out.size() == _num_bytes) {
+                                reader.read_binary_into(_decoder, out);
+                            } else {
+                                Serialization range;
+                                reader.read_binary_range(_decoder, offset, out.size(), range);
+                                std::ranges::copy(range.as_span(), out.begin());
+                            }
                         });
-                    }
-                });
+                    });
+                };
+                result = _make_lazy_field(
+                    _cache_key_for(e),
+                    std::move(expected_layout),
+                    prec,
+                    std::move(read_into)
+                );
             });
             return result;
         });
     }
 
+    // create a field that reads its values with the given function (from the cache, if one is used)
+    template<std::invocable ReadFunction>
+    FieldPtr _make_lazy_field(FieldCacheKey key,
+                              MDLayout layout,
+                              DynamicPrecision prec,
+                              ReadFunction&& read) const {
+        return make_field_ptr(LazyField{
+            std::move(key),
+            std::move(layout),
+            std::move(prec),
+            [_cache=_opts.cache, _read=std::forward<ReadFunction>(read)] (const FieldCacheKey& k) {
+                if (_cache)
+                    return _cache->get_or_insert(k, _read);
+                return _read();
+            }
+        });
+    }
+
+    // create a field that writes (ranges of) its values directly into given buffers (copied from the cache if cached)
+    template<std::invocable<std::size_t, std::span<std::byte>> ReadIntoFunction>
+    FieldPtr _make_lazy_field(FieldCacheKey key,
+                              MDLayout layout,
+                              DynamicPrecision prec,
+                              ReadIntoFunction&& read_into) const {
+        const std::size_t num_bytes = layout.number_of_entries()*prec.size_in_bytes();
+        auto read = [_read_into=read_into, _num_bytes=num_bytes] () {
+            Serialization result{_num_bytes};
+            _read_into(0, result.as_span());
+            return result;
+        };
+        return make_field_ptr(LazyField{
+            std::move(key),
+            std::move(layout),
+            std::move(prec),
+            [_cache=_opts.cache, _read=read] (const FieldCacheKey& k) {
+                if (_cache)
+                    return _cache->get_or_insert(k, _read);
+                return _read();
+            },
+            [
+                _cache=_opts.cache,
+                _read=std::move(read),
+                _read_into=std::forward<ReadIntoFunction>(read_into),
+                _num_bytes=num_bytes
+            ] (const FieldCacheKey& k, std::size_t offset, std::span<std::byte> out) {
+                // read through the cache when reading all values, or when the values are cached anyways
+                if (_cache && (out.size() == _num_bytes || _cache->contains(k))) {
+                    const Serialization cached = _cache->get_or_insert(k, _read);
+                    std::ranges::copy(cached.as_span().subspan(offset, out.size()), out.begin());
+                    return;
+                }
+                _read_into(offset, out);
+            }
+        });
+    }
+
+    // the array is identified by its name and the position of its data in the file
+    // (for ascii arrays, the number of values to be read is also part of the identifier)
+    FieldCacheKey _cache_key_for(const XMLElement& e, std::optional<std::size_t> number_of_values = {}) const {
+        const auto location = _stream_location_for(e);
+        std::string array = e.get_attribute_or(std::string{""}, "Name");
+        array += "@" + std::to_string(location.begin + location.offset.value_or(0));
+        if (number_of_values)
+            array += "[" + std::to_string(number_of_values.value()) + "]";
+        return {.file = _filename, .array = std::move(array)};
+    }
+
     DynamicPrecision _header_precision() const {
         if (get().has_attribute("header_type"))
             return from_precision_attribute(get().get_attribute("header_type"));
@@ -920,23 +1451,30 @@ class XMLReaderHelper {
     }
 
     std::size_t _deduce_number_of_values(const XMLElement& element) const {
-        std::ifstream file{_filename};
-        XMLDetail::_move_to_data(_stream_location_for(element), file);
-
+        const auto location = _stream_location_for(element);
         if (element.get_attribute("format") == "ascii") {
             const auto precision = from_precision_attribute(element.get_attribute("type"));
-            return precision.visit([&] <typename T> (const Precision<T>&) {
-                using _T = std::conditional_t<
-                    std::integral<T> && sizeof(T) < 4,  // see XMLDetail::DataArrayReader::read_ascii
-                    int,
-                    T
-                >;
-                return std::ranges::distance(std::ranges::istream_view<_T>{file});
+            return _context->with_stream([&] (std::istream& file) {
+                XMLDetail::_move_to_data(location, file);
+                return precision.visit([&] <typename T> (const Precision<T>&) {
+                    using _T = std::conditional_t<
+                        std::integral<T> && sizeof(T) < 4,  // operator>> reads characters for small integral types
+                        int,
+                        T
+                    >;
+                    return static_cast<std::size_t>(std::ranges::distance(std::ranges::istream_view<_T>{file}));
+                });
             });
         }
 
-        InputStreamHelper helper{file};
-        const auto header = _read_binary_data_array_header(helper, element);
+        const auto header_position = location.begin + location.offset.value_or(0);
+        const auto header = _context->header_at(header_position, [&] () {
+            return _context->with_stream([&] (std::istream& file) {
+                XMLDetail::_move_to_data(location, file);
+                InputStreamHelper helper{file};
+                return _read_binary_data_array_header(helper, element);
+            });
+        });
         if (get().has_attribute("compressor") && header.size() < 3)
             throw ValueError("Could not read compression header");
         const std::size_t number_of_bytes = [&] () {
@@ -1011,6 +1549,8 @@ class XMLReaderHelper {
     }
 
     std::string _filename;
+    XMLReaderOptions _opts;
+    std::shared_ptr<XMLDetail::InputContext> _context;
     XMLParser _parser;
 };
 
@@ -299,6 +299,17 @@ class Writer {
         });
     }
 
+    /*!
+     * \brief Set the options for evaluating point and cell functions.
+     * \details Allows for evaluating the functions on multiple threads for grids whose
+     *          point/cell ranges are random-access. Only affects fields set after this call.
+     */
+    void set_entity_field_options(EntityFieldOptions opts) {
+        _visit_writer([&] (auto& writer) {
+            writer.set_entity_field_options(opts);
+        });
+    }
+
     /*!
      * \brief Copy all inserted fields into another writer.
      * \param out The writer into which to copy all fields of this writer.
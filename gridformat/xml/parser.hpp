@@ -9,6 +9,8 @@
 
 #include <cmath>
 #include <string>
+#include <string_view>
+#include <algorithm>
 #include <memory>
 #include <istream>
 #include <fstream>
@@ -36,10 +38,14 @@ namespace GridFormat {
  *       are stored separately and the content can be retrieved via get_content(const XMLElement&).
  * \note Content inside XML elements is assumed to be either before or after child elements. If multiple
          pieces of content are intermingled with child elements, only the first piece of content will be detected.
+ * \note If the content of an element is skipped and only closing tags follow it (e.g. the appendix of vtk
+ *       files), its end is found by searching backwards from the end of the stream instead of reading the content.
  * \note This implementation is not a fully-fleshed XML parser, but suffices for our requirements.
  *       It is likely to fail when textual content that can be mistaken for xml is inside the elements.
  */
 class XMLParser {
+    static constexpr std::streamsize max_trailing_chars = 4096;
+
  public:
     using ContentSkipFunction = std::function<bool(const XMLElement&)>;
 
@@ -59,11 +65,10 @@ class XMLParser {
     explicit XMLParser(const std::string& filename,
                        const std::string& root_name = "ROOT",
                        const ContentSkipFunction& skip_content_parsing = [] (const XMLElement&) { return false; })
-    : _owned{std::make_unique<std::ifstream>()}
+    : _owned{std::make_unique<std::ifstream>(filename)}
     , _helper{*_owned}
     , _element{root_name}
     , _skip_content{skip_content_parsing} {
-        _owned->open(filename);
         while (_parse_next_element(_element)) {}
     }
 
@@ -78,6 +83,17 @@ class XMLParser {
         while (_parse_next_element(_element)) {}
     }
 
+    //! Overload for reading from a stream whose ownership is transferred to the parser
+    explicit XMLParser(std::unique_ptr<std::istream> stream,
+                       const std::string& root_name = "ROOT",
+                       const ContentSkipFunction& skip_content_parsing = [] (const XMLElement&) { return false; })
+    : _owned{std::move(stream)}
+    , _helper{*_owned}
+    , _element{root_name}
+    , _skip_content{skip_content_parsing} {
+        while (_parse_next_element(_element)) {}
+    }
+
     //! Return a reference the read xml representation
     const XMLElement& get_xml() const & {
         return _element;
@@ -115,7 +131,9 @@ class XMLParser {
         auto content_end_pos = content_begin_pos;
 
         if (_skip_content(parent)) {
-            if (!_helper.shift_until_substr(close_tag))
+            if (const auto close_tag_pos = _find_trailing_close_tag(close_tag); close_tag_pos.has_value())
+                _helper.seek_position(close_tag_pos.value());
+            else if (!_helper.shift_until_substr(close_tag))
                 throw IOError("Could not find closing tag: " + close_tag);
             content_end_pos = _helper.position();
             _helper.shift_by(close_tag.size());
@@ -154,6 +172,67 @@ class XMLParser {
         _content_bounds[&parent] = StreamBounds{.begin_pos = content_begin_pos, .end_pos = content_end_pos};
     }
 
+    // Skipped content is typically large (e.g. the appendix in vtk files) and followed only by the closing tags
+    // of its ancestors. In that case, the closing tag can be found by searching backwards from the end of the
+    // stream, which avoids reading through the entire content. Returns none if this is not the case.
+    std::optional<std::streamsize> _find_trailing_close_tag(const std::string& close_tag) {
+        const auto begin_pos = _helper.position();
+        if (begin_pos < 0)
+            return {};
+
+        _helper.seek_end();
+        const auto end_pos = _helper.position();
+        if (end_pos < begin_pos)
+            return {};
+
+        const auto tail_begin_pos = std::max(begin_pos, end_pos - max_trailing_chars);
+        _helper.seek_position(tail_begin_pos);
+        const std::string tail = _helper.read_chunk(static_cast<std::size_t>(end_pos - tail_begin_pos));
+        _helper.seek_position(begin_pos);
+
+        const auto close_tag_pos = tail.rfind(close_tag);
+        if (close_tag_pos == std::string::npos)
+            return {};
+        if (!_is_closing_tags_only(std::string_view{tail}.substr(close_tag_pos + close_tag.size())))
+            return {};
+        return tail_begin_pos + static_cast<std::streamsize>(close_tag_pos);
+    }
+
+    // returns true if the given characters only contain the end of a closing tag, followed by closing tags,
+    // comments or whitespace (i.e. '>   </parent>  <!--comment--> </grandparent>')
+    static bool _is_closing_tags_only(std::string_view chars) {
+        static constexpr std::string_view whitespace = " \n\t\r";
+        const auto skip_whitespace = [&] () {
+            chars.remove_prefix(std::min(chars.find_first_not_of(whitespace), chars.size()));
+        };
+        const auto skip_past = [&] (std::string_view end) {
+            const auto pos = chars.find(end);
+            if (pos == std::string_view::npos)
+                return false;
+            chars.remove_prefix(pos + end.size());
+            return true;
+        };
+
+        skip_whitespace();
+        if (!chars.starts_with('>'))
+            return false;
+        chars.remove_prefix(1);
+        while (true) {
+            skip_whitespace();
+            if (chars.empty())
+                return true;
+            if (chars.starts_with("<!--")) {
+                if (!skip_past("-->"))
+                    return false;
+            } else if (chars.starts_with("</")) {
+                if (!skip_past(">"))
+                    return false;
+            } else {
+                return false;
+            }
+        }
+    }
+
     // parse the next child element from the stream and return the position after it (or none if no child found)
     std::optional<std::streamsize> _parse_next_element(XMLElement& parent, const std::string& close_tag = "") {
         while (true) {
@@ -270,7 +349,7 @@ class XMLParser {
         return std::make_pair(std::move(attr_name), std::move(attr_value));
     }
 
-    std::unique_ptr<std::ifstream> _owned;
+    std::unique_ptr<std::istream> _owned;
     InputStreamHelper _helper;
     XMLElement _element;
     ContentSkipFunction _skip_content;
@@ -1,7 +1,10 @@
 // SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
 // SPDX-License-Identifier: MIT
 
+#include <span>
+#include <array>
 #include <vector>
+#include <cstddef>
 #include <memory>
 #include <ranges>
 #include <algorithm>
@@ -125,5 +128,56 @@ int main() {
         expect(throws<GridFormat::TypeError>([&] () { field->template export_to<int>(); }));
     };
 
+    "field_export_to_contiguous_range_serializes_into_range"_test = [] () {
+        class CountingField : public MyField {
+         public:
+            mutable int serialized_into = 0;
+         private:
+            void _serialize_into(std::span<std::byte> out) const override {
+                serialized_into++;
+                MyField::_serialize_into(out);
+            }
+        };
+
+        CountingField field;
+        std::vector<int> out(4);
+        field.export_to(out, GridFormat::Field::no_resize);
+        expect(eq(field.serialized_into, 1));
+        expect(std::ranges::equal(out, std::vector{1, 2, 3, 4}));
+
+        std::vector<std::array<int, 2>> out_arrays;
+        field.export_to(out_arrays);
+        expect(eq(field.serialized_into, 2));
+        expect(eq(out_arrays.size(), 2_ul));
+        expect(std::ranges::equal(out_arrays[1], std::array{3, 4}));
+
+        // precision mismatch requires a cast
+        std::vector<double> out_double;
+        field.export_to(out_double);
+        expect(eq(field.serialized_into, 2));
+        expect(std::ranges::equal(out_double, std::vector<double>{1, 2, 3, 4}));
+    };
+
+    "field_serialized_range"_test = [] () {
+        std::unique_ptr<GridFormat::Field> field = std::make_unique<MyField>();
+        const auto range = field->serialized_range(1, 2);
+        expect(std::ranges::equal(range.as_span_of(GridFormat::Precision<int>{}), std::vector{2, 3}));
+        expect(eq(field->serialized_range(4, 0).size(), 0_ul));
+        expect(throws<GridFormat::SizeError>([&] () { field->serialized_range(3, 2); }));
+    };
+
+    "field_serialize_bytes_into"_test = [] () {
+        std::unique_ptr<GridFormat::Field> field = std::make_unique<MyField>();
+        std::vector<int> out(2);
+        field->serialize_bytes_into(sizeof(int), std::as_writable_bytes(std::span{out}));
+        expect(std::ranges::equal(out, std::vector{2, 3}));
+
+        const auto serialization = field->serialized();
+        std::vector<std::byte> bytes(3);
+        field->serialize_bytes_into(sizeof(int) + 2, bytes);
+        expect(std::ranges::equal(bytes, serialization.as_span().subspan(sizeof(int) + 2, 3)));
+        expect(throws<GridFormat::SizeError>([&] () { field->serialize_bytes_into(4*sizeof(int) - 2, bytes); }));
+    };
+
     return 0;
 }
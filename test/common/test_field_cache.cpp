@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+#include <gridformat/common/serialization.hpp>
+#include <gridformat/common/field_cache.hpp>
+
+#include "../testing.hpp"
+
+int main() {
+    using GridFormat::Testing::operator""_test;
+    using GridFormat::Testing::expect;
+    using GridFormat::Testing::eq;
+
+    std::size_t num_reads = 0;
+    const auto reader_for = [&] (std::size_t size, int value) {
+        return [&num_reads, size, value] () {
+            num_reads++;
+            GridFormat::Serialization s{size};
+            std::ranges::fill(s.as_span(), static_cast<std::byte>(value));
+            return s;
+        };
+    };
+
+    "field_cache_hits_and_misses"_test = [&] () {
+        num_reads = 0;
+        GridFormat::FieldCache cache{100};
+        const GridFormat::FieldCacheKey key{.file = "file", .array = "array"};
+        const auto first = cache.get_or_insert(key, reader_for(10, 1));
+        const auto second = cache.get_or_insert(key, reader_for(10, 2));
+        expect(eq(num_reads, std::size_t{1}));
+        expect(std::ranges::equal(first.as_span(), second.as_span()));
+
+        const auto other_step = cache.get_or_insert({.file = "file", .array = "array", .step = 1}, reader_for(10, 3));
+        expect(eq(num_reads, std::size_t{2}));
+        expect(eq(other_step.as_span()[0], std::byte{3}));
+
+        const auto stats = cache.statistics();
+        expect(eq(stats.hits, std::size_t{1}));
+        expect(eq(stats.misses, std::size_t{2}));
+        expect(eq(stats.number_of_entries, std::size_t{2}));
+        expect(eq(stats.size_in_bytes, std::size_t{20}));
+    };
+
+    "field_cache_lru_eviction"_test = [&] () {
+        GridFormat::FieldCache cache{30};
+        const GridFormat::FieldCacheKey a{.file = "f", .array = "a"};
+        const GridFormat::FieldCacheKey b{.file = "f", .array = "b"};
+        const GridFormat::FieldCacheKey c{.file = "f", .array = "c"};
+        cache.get_or_insert(a, reader_for(10, 1));
+        cache.get_or_insert(b, reader_for(10, 2));
+        cache.get_or_insert(a, reader_for(10, 1));  // a is now more recently used than b
+        cache.get_or_insert(c, reader_for(15, 3));
+        expect(cache.contains(a));
+        expect(!cache.contains(b));
+        expect(cache.contains(c));
+        expect(eq(cache.statistics().evictions, std::size_t{1}));
+        expect(eq(cache.statistics().size_in_bytes, std::size_t{25}));
+    };
+
+    "field_cache_too_large_data"_test = [&] () {
+        num_reads = 0;
+        GridFormat::FieldCache cache{10};
+        const GridFormat::FieldCacheKey key{.file = "f", .array = "a"};
+        expect(eq(cache.get_or_insert(key, reader_for(20, 1)).size(), std::size_t{20}));
+        expect(!cache.contains(key));
+        cache.get_or_insert(key, reader_for(20, 1));
+        expect(eq(num_reads, std::size_t{2}));
+    };
+
+    "field_cache_clear"_test = [&] () {
+        GridFormat::FieldCache cache{10};
+        cache.get_or_insert({.file = "f", .array = "a"}, reader_for(5, 1));
+        cache.clear();
+        expect(eq(cache.statistics().number_of_entries, std::size_t{0}));
+        expect(eq(cache.statistics().size_in_bytes, std::size_t{0}));
+        expect(!cache.contains({.file = "f", .array = "a"}));
+    };
+
+    return 0;
+}
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
 // SPDX-License-Identifier: MIT
 
+#include <span>
 #include <array>
 #include <vector>
 #include <memory>
@@ -165,6 +166,16 @@ int main() {
         ));
     };
 
+    "transformed_field_extend_serialize_bytes_into"_test = [] () {
+        auto field_ptr = GridFormat::make_field_ptr(
+            RangeField{std::vector<std::array<int, 2>>{{2, 3}, {4, 5}, {6, 7}}}
+        );
+        TransformedField extended{field_ptr, extend_to(GridFormat::MDLayout{{3}})};
+        std::vector<int> out(5);
+        extended.serialize_bytes_into(2*sizeof(int), std::as_writable_bytes(std::span{out}));
+        expect(std::ranges::equal(out, std::vector<int>{0, 4, 5, 0, 6}));
+    };
+
     "transformed_field_extend_all"_test = [] () {
         auto field_ptr = GridFormat::make_field_ptr(
             RangeField{
@@ -287,6 +298,17 @@ int main() {
         ));
     };
 
+    "merged_fields_serialize_bytes_into"_test = [] () {
+        GridFormat::MergedField merged{
+            GridFormat::make_field_ptr(RangeField{std::vector<int>{42, 43}}),
+            GridFormat::make_field_ptr(RangeField{std::vector<int>{44}}),
+            GridFormat::make_field_ptr(RangeField{std::vector<int>{45, 46}})
+        };
+        std::vector<int> out(3);
+        merged.serialize_bytes_into(sizeof(int), std::as_writable_bytes(std::span{out}));
+        expect(std::ranges::equal(out, std::vector<int>{43, 44, 45}));
+    };
+
     "merged_fields_throw_with_non_matching_layouts"_test = [] () {
         expect(throws<GridFormat::ValueError>([] () {
             GridFormat::MergedField merged{
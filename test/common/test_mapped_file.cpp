@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+
+#include <string>
+#include <fstream>
+#include <utility>
+#include <algorithm>
+
+#include <gridformat/common/exceptions.hpp>
+#include <gridformat/common/mapped_file.hpp>
+
+#include "../testing.hpp"
+
+int main() {
+    using GridFormat::Testing::operator""_test;
+    using GridFormat::Testing::expect;
+    using GridFormat::Testing::throws;
+    using GridFormat::Testing::eq;
+
+    const std::string content = "some file content\nwith several lines";
+    std::ofstream{"mapped_file_test.txt", std::ios::binary} << content;
+    std::ofstream{"mapped_file_test_empty.txt"};
+
+    "mapped_file_data"_test = [&] () {
+        GridFormat::MappedFile file{"mapped_file_test.txt"};
+        expect(eq(file.size(), content.size()));
+        expect(std::ranges::equal(file.data(), content));
+    };
+
+    "mapped_file_move"_test = [&] () {
+        GridFormat::MappedFile file{"mapped_file_test.txt"};
+        GridFormat::MappedFile moved{std::move(file)};
+        expect(eq(file.size(), std::size_t{0}));
+        expect(std::ranges::equal(moved.data(), content));
+    };
+
+    "mapped_file_empty"_test = [&] () {
+        GridFormat::MappedFile file{"mapped_file_test_empty.txt"};
+        expect(eq(file.size(), std::size_t{0}));
+        expect(file.data().empty());
+    };
+
+    "mapped_file_missing"_test = [&] () {
+        expect(throws<GridFormat::IOError>([] () { GridFormat::MappedFile{"_non_existing_file.txt"}; }));
+    };
+
+    return 0;
+}
@@ -1,12 +1,16 @@
 // SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
 // SPDX-License-Identifier: MIT
 
+#include <span>
+#include <list>
+#include <array>
 #include <vector>
 #include <ranges>
 #include <tuple>
 
 #include <gridformat/common/range_field.hpp>
 #include <gridformat/common/exceptions.hpp>
+#include <gridformat/common/precision.hpp>
 
 #include "../testing.hpp"
 
@@ -39,6 +43,16 @@ int main() {
         expect(std::ranges::equal(span, std::vector<double>{1., 2., 3., 4.}));
     };
 
+    "range_field_serialize_bytes_into"_test = [] () {
+        const GridFormat::RangeField field{
+            std::vector<std::array<int, 2>>{{1, 2}, {3, 4}, {5, 6}},
+            GridFormat::Precision<double>{}
+        };
+        std::vector<double> out(3);
+        field.serialize_bytes_into(sizeof(double), std::as_writable_bytes(std::span{out}));
+        expect(std::ranges::equal(out, std::vector<double>{2., 3., 4.}));
+    };
+
     "range_field_by_reference"_test = [] () {
         std::vector<int> data{1, 2, 3, 4};
         const GridFormat::RangeField field{data};
@@ -112,5 +126,18 @@ int main() {
         }));
     };
 
+    "range_field_contiguous_bytes"_test = [] () {
+        const std::vector<std::array<double, 2>> values{{1.0, 2.0}, {3.0, 4.0}};
+        const GridFormat::RangeField field{values};
+        const auto bytes = field.contiguous_bytes();
+        expect(bytes.has_value());
+        expect(eq(bytes->data(), std::as_bytes(std::span{values}).data()));
+        expect(eq(bytes->size(), 4*sizeof(double)));
+
+        // values have to be converted if the precision differs or if the range is not contiguous
+        expect(!GridFormat::RangeField{values, GridFormat::float32}.contiguous_bytes().has_value());
+        expect(!GridFormat::RangeField{std::list<int>{1, 2}}.contiguous_bytes().has_value());
+    };
+
     return 0;
 }
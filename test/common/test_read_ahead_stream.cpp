@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+
+#include <string>
+#include <fstream>
+#include <algorithm>
+
+#include <gridformat/common/exceptions.hpp>
+#include <gridformat/common/read_ahead_stream.hpp>
+
+#include "../testing.hpp"
+
+int main() {
+    using GridFormat::Testing::operator""_test;
+    using GridFormat::Testing::expect;
+    using GridFormat::Testing::throws;
+    using GridFormat::Testing::eq;
+
+    std::string content(1000, ' ');
+    std::ranges::generate(content, [i=0] () mutable { return static_cast<char>('a' + (i++)%26); });
+    std::ofstream{"read_ahead_stream_test.txt", std::ios::binary} << content;
+
+    const auto read = [] (std::istream& s, std::size_t n) {
+        std::string result(n, ' ');
+        s.read(result.data(), static_cast<std::streamsize>(n));
+        result.resize(static_cast<std::size_t>(s.gcount()));
+        return result;
+    };
+
+    "read_ahead_stream_sequential_reads"_test = [&] () {
+        for (std::size_t window : {1, 7, 64, 5000}) {
+            GridFormat::ReadAheadFileStream s{"read_ahead_stream_test.txt", window};
+            std::string result;
+            for (std::size_t n : {3, 10, 100, 1, 500})
+                result += read(s, n);
+            expect(eq(result, content.substr(0, result.size())));
+            result += read(s, 1000);
+            expect(eq(result, content));
+            expect(s.eof());
+        }
+    };
+
+    "read_ahead_stream_seek"_test = [&] () {
+        GridFormat::ReadAheadFileStream s{"read_ahead_stream_test.txt", 64};
+        s.seekg(10);
+        expect(eq(read(s, 5), content.substr(10, 5)));
+        s.seekg(40);  // within the window
+        expect(eq(static_cast<std::size_t>(s.tellg()), std::size_t{40}));
+        expect(eq(read(s, 30), content.substr(40, 30)));
+        s.seekg(-5, std::ios::cur);
+        expect(eq(read(s, 5), content.substr(65, 5)));
+        s.seekg(-3, std::ios::end);
+        expect(eq(read(s, 10), content.substr(997)));
+        s.clear();
+        s.seekg(900);
+        expect(eq(static_cast<char>(s.peek()), content[900]));
+        s.seekg(1001);
+        expect(s.fail());
+    };
+
+    "read_ahead_stream_missing_file"_test = [&] () {
+        expect(throws<GridFormat::IOError>([] () { GridFormat::ReadAheadFileStream{"_non_existing_file.txt"}; }));
+    };
+
+    return 0;
+}
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+
+#include <span>
+#include <string>
+#include <sstream>
+#include <string_view>
+
+#include <gridformat/common/span_stream.hpp>
+
+#include "../testing.hpp"
+
+int main() {
+    using GridFormat::Testing::operator""_test;
+    using GridFormat::Testing::expect;
+    using GridFormat::Testing::eq;
+
+    const std::string_view content = "hello span stream";
+    const std::span<const char> chars{content.data(), content.size()};
+
+    "span_stream_read"_test = [&] () {
+        GridFormat::SpanInputStream stream{chars};
+        std::string word;
+        stream >> word;
+        expect(eq(word, std::string{"hello"}));
+        expect(eq(static_cast<std::size_t>(stream.tellg()), std::size_t{5}));
+        stream >> word >> word;
+        expect(eq(word, std::string{"stream"}));
+        stream >> word;
+        expect(stream.eof());
+    };
+
+    "span_stream_seek"_test = [&] () {
+        GridFormat::SpanInputStream stream{chars};
+        stream.seekg(6);
+        expect(eq(static_cast<char>(stream.get()), 's'));
+        stream.seekg(-6, std::ios_base::end);
+        expect(eq(static_cast<char>(stream.get()), 's'));
+        stream.seekg(-2, std::ios_base::cur);
+        expect(eq(static_cast<char>(stream.get()), ' '));
+        stream.seekg(100);
+        expect(stream.fail());
+    };
+
+    "span_stream_buffer_access"_test = [&] () {
+        GridFormat::SpanInputStream stream{chars};
+        stream.seekg(6);
+        auto* buffer = GridFormat::SpanStreamBuffer::of(stream);
+        expect(buffer != nullptr);
+        expect(eq(buffer->remaining().size(), content.size() - 6));
+        expect(buffer->remaining().data() == content.data() + 6);
+        buffer->consume(5);
+        expect(eq(static_cast<std::size_t>(stream.tellg()), std::size_t{11}));
+
+        std::istringstream other{"other"};
+        expect(GridFormat::SpanStreamBuffer::of(other) == nullptr);
+    };
+
+    return 0;
+}
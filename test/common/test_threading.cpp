@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <stdexcept>
+
+#include <gridformat/common/threading.hpp>
+
+#include "../testing.hpp"
+
+int main() {
+    using GridFormat::Testing::operator""_test;
+    using GridFormat::Testing::expect;
+    using GridFormat::Testing::throws;
+    using GridFormat::Testing::eq;
+
+    "number_of_threads_for"_test = [] () {
+        expect(eq(GridFormat::Threading::number_of_threads_for(10, 4), std::size_t{4}));
+        expect(eq(GridFormat::Threading::number_of_threads_for(2, 4), std::size_t{2}));
+        expect(eq(GridFormat::Threading::number_of_threads_for(0, 4), std::size_t{1}));
+        expect(GridFormat::Threading::number_of_threads_for(1000, 0) >= 1);
+    };
+
+    "parallel_for_visits_all_indices"_test = [] () {
+        for (std::size_t num_threads : {1, 2, 5, 0}) {
+            std::vector<std::size_t> values(1000, 0);
+            GridFormat::Threading::parallel_for(values.size(), num_threads, [&] (std::size_t i) {
+                values[i] += i;
+            });
+            std::vector<std::size_t> expected(values.size());
+            std::iota(expected.begin(), expected.end(), 0);
+            expect(std::ranges::equal(values, expected));
+        }
+    };
+
+    "parallel_for_rethrows"_test = [] () {
+        expect(throws<std::runtime_error>([] () {
+            GridFormat::Threading::parallel_for(100, 4, [] (std::size_t i) {
+                if (i == 42)
+                    throw std::runtime_error("error");
+            });
+        }));
+    };
+
+    return 0;
+}
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <algorithm>
+#include <numeric>
 
 #include <gridformat/common/serialization.hpp>
 #include <gridformat/compression/lz4.hpp>
@@ -71,5 +72,35 @@ int main() {
         expect(std::ranges::equal(bytes.template as_span_of<int>(), data));
     };
 
+    "lz4_compression_multithreaded"_test = [] () {
+        std::vector<int> data(10000);
+        std::ranges::for_each(data, [i=int{0}] (int& value) mutable { value = (i++)%42; });
+        const auto number_of_bytes = data.size()*sizeof(int);
+
+        GridFormat::Serialization serial_bytes{number_of_bytes};
+        std::ranges::copy(data, serial_bytes.template as_span_of<int>().begin());
+        GridFormat::Serialization threaded_bytes = serial_bytes;
+
+        const GridFormat::Compression::LZ4 serial{{.block_size = 1000}};
+        const GridFormat::Compression::LZ4 threaded{{.block_size = 1000, .num_threads = 4}};
+        const auto serial_blocks = serial.compress(serial_bytes);
+        const auto threaded_blocks = threaded.compress(threaded_bytes);
+        expect(eq(threaded_blocks.number_of_blocks, serial_blocks.number_of_blocks));
+        expect(std::ranges::equal(threaded_blocks.compressed_block_sizes, serial_blocks.compressed_block_sizes));
+        const auto compressed_bytes = std::accumulate(
+            serial_blocks.compressed_block_sizes.begin(),
+            serial_blocks.compressed_block_sizes.end(),
+            std::size_t{0}
+        );
+        expect(std::ranges::equal(
+            threaded_bytes.as_span().first(compressed_bytes),
+            serial_bytes.as_span().first(compressed_bytes)
+        ));
+
+        threaded.decompress(threaded_bytes, threaded_blocks);
+        expect(eq(threaded_bytes.size(), number_of_bytes));
+        expect(std::ranges::equal(threaded_bytes.template as_span_of<int>(), data));
+    };
+
     return 0;
 }
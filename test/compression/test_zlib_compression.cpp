@@ -1,10 +1,15 @@
 // SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
 // SPDX-License-Identifier: MIT
 
+#include <span>
 #include <vector>
+#include <cstddef>
 #include <algorithm>
+#include <numeric>
+#include <utility>
 
 #include <gridformat/common/serialization.hpp>
+#include <gridformat/common/exceptions.hpp>
 #include <gridformat/compression/zlib.hpp>
 #include "../testing.hpp"
 
@@ -12,6 +17,7 @@ int main() {
     using GridFormat::Testing::operator""_test;
     using GridFormat::Testing::expect;
     using GridFormat::Testing::eq;
+    using GridFormat::Testing::throws;
 
     "zlib_compression_default_opts"_test = [] () {
         GridFormat::Serialization bytes{1000};
@@ -71,5 +77,75 @@ int main() {
         expect(std::ranges::equal(bytes.template as_span_of<int>(), data));
     };
 
+    "zlib_decompression_into_buffer"_test = [] () {
+        std::vector<int> data(1000);
+        std::ranges::for_each(data, [i=int{0}] (int& value) mutable { value = (i++)%42; });
+        const auto number_of_bytes = data.size()*sizeof(int);
+
+        GridFormat::Serialization bytes{number_of_bytes};
+        std::ranges::copy(data, bytes.template as_span_of<int>().begin());
+
+        GridFormat::Compression::ZLIB compressor{{.block_size = 100}};
+        const auto blocks = compressor.compress(bytes);
+        std::vector<int> out(data.size());
+        compressor.decompress_into(std::as_const(bytes).as_span(), blocks, std::as_writable_bytes(std::span{out}));
+        expect(std::ranges::equal(out, data));
+        expect(throws<GridFormat::SizeError>([&] () {
+            compressor.decompress_into(std::as_const(bytes).as_span(), blocks, std::as_writable_bytes(std::span{out}.first(10)));
+        }));
+    };
+
+    "zlib_compression_multithreaded"_test = [] () {
+        std::vector<int> data(10000);
+        std::ranges::for_each(data, [i=int{0}] (int& value) mutable { value = (i++)%42; });
+        const auto number_of_bytes = data.size()*sizeof(int);
+
+        GridFormat::Serialization serial_bytes{number_of_bytes};
+        std::ranges::copy(data, serial_bytes.template as_span_of<int>().begin());
+        GridFormat::Serialization threaded_bytes = serial_bytes;
+
+        const GridFormat::Compression::ZLIB serial{{.block_size = 1000}};
+        const GridFormat::Compression::ZLIB threaded{{.block_size = 1000, .num_threads = 4}};
+        const auto serial_blocks = serial.compress(serial_bytes);
+        const auto threaded_blocks = threaded.compress(threaded_bytes);
+        expect(eq(threaded_blocks.number_of_blocks, serial_blocks.number_of_blocks));
+        expect(std::ranges::equal(threaded_blocks.compressed_block_sizes, serial_blocks.compressed_block_sizes));
+        const auto compressed_bytes = std::accumulate(
+            serial_blocks.compressed_block_sizes.begin(),
+            serial_blocks.compressed_block_sizes.end(),
+            std::size_t{0}
+        );
+        expect(std::ranges::equal(
+            threaded_bytes.as_span().first(compressed_bytes),
+            serial_bytes.as_span().first(compressed_bytes)
+        ));
+
+        threaded.decompress(threaded_bytes, threaded_blocks);
+        expect(eq(threaded_bytes.size(), number_of_bytes));
+        expect(std::ranges::equal(threaded_bytes.template as_span_of<int>(), data));
+    };
+
+    "zlib_compression_blockwise"_test = [] () {
+        std::vector<int> data(10000);
+        std::ranges::for_each(data, [i=int{0}] (int& value) mutable { value = (i++)%42; });
+        const auto number_of_bytes = data.size()*sizeof(int);
+
+        GridFormat::Serialization bytes{number_of_bytes};
+        std::ranges::copy(data, bytes.template as_span_of<int>().begin());
+        for (std::size_t num_threads : {1, 4}) {
+            const GridFormat::Compression::ZLIB compressor{{.block_size = 1000, .num_threads = num_threads}};
+            std::vector<std::byte> streamed;
+            const auto streamed_blocks = compressor.compress_blockwise(bytes.as_span(), [&] (std::span<const std::byte> block) {
+                streamed.insert(streamed.end(), block.begin(), block.end());
+            });
+
+            GridFormat::Serialization compressed = bytes;
+            const auto blocks = compressor.compress(compressed);
+            expect(std::ranges::equal(streamed_blocks.compressed_block_sizes, blocks.compressed_block_sizes));
+            expect(eq(streamed.size(), blocks.compressed_size()));
+            expect(std::ranges::equal(streamed, compressed.as_span()));
+        }
+    };
+
     return 0;
 }
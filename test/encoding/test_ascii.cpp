@@ -5,7 +5,10 @@
 #include <string>
 #include <vector>
 #include <span>
+#include <cstdint>
+#include <algorithm>
 
+#include <gridformat/common/span_stream.hpp>
 #include <gridformat/encoding/ascii.hpp>
 #include "../testing.hpp"
 
@@ -13,6 +16,7 @@ int main() {
     using GridFormat::Testing::operator""_test;
     using GridFormat::Testing::expect;
     using GridFormat::Testing::eq;
+    using GridFormat::Testing::throws;
 
     "ascii_encoded_stream"_test = [] () {
         std::ostringstream s;
@@ -30,5 +34,138 @@ int main() {
         expect(eq(s.str(), std::string{"1,2,3,42,"}));
     };
 
+    "ascii_encoded_stream_shortest_round_trip"_test = [] () {
+        std::ostringstream s;
+        std::vector<double> v{0.1, 1.0/3.0, -2.5e-300, 1e21};
+        GridFormat::Encoding::Ascii::with({.delimiter = " "})(s).write(std::span{v});
+        expect(eq(s.str(), std::string{"0.1 0.3333333333333333 -2.5e-300 1e+21 "}));
+
+        std::istringstream in{s.str()};
+        std::vector<double> read(v.size());
+        GridFormat::AsciiDecoder{}.decode_from(in, std::span{read});
+        expect(std::ranges::equal(read, v));
+    };
+
+    "ascii_encoded_stream_small_integers"_test = [] () {
+        std::ostringstream s;
+        std::vector<std::int8_t> v{1, -2, 127};
+        GridFormat::Encoding::Ascii::with({.delimiter = ","})(s).write(std::span{v});
+        expect(eq(s.str(), std::string{"1,-2,127,"}));
+    };
+
+    "ascii_encoded_stream_multithreaded"_test = [] () {
+        std::vector<double> v(100'003);
+        std::ranges::for_each(v, [i=0] (double& value) mutable { value = 1.0/static_cast<double>(++i); });
+        const GridFormat::AsciiFormatOptions opts{
+            .delimiter = " ",
+            .line_prefix = "  ",
+            .entries_per_line = 7,
+            .num_cached_lines = 10
+        };
+        auto threaded_opts = opts;
+        threaded_opts.num_threads = 4;
+
+        std::ostringstream serial;
+        std::ostringstream threaded;
+        GridFormat::Encoding::Ascii::with(opts)(serial).write(std::span{v});
+        GridFormat::Encoding::Ascii::with(threaded_opts)(threaded).write(std::span{v});
+        expect(eq(serial.str(), threaded.str()));
+        expect(eq(std::ranges::count(serial.str(), '\n'), std::ptrdiff_t{100'003/7}));
+    };
+
+    "ascii_decoder"_test = [] () {
+        std::istringstream s{"  1 -2\n\t+3   42\n 5"};
+        std::vector<int> values(4);
+        expect(eq(GridFormat::AsciiDecoder{}.decode_from(s, std::span{values}), std::size_t{4}));
+        expect(std::ranges::equal(values, std::vector<int>{1, -2, 3, 42}));
+
+        // stream is positioned behind the last parsed value
+        int next;
+        s >> next;
+        expect(eq(next, 5));
+    };
+
+    "ascii_decoder_small_types"_test = [] () {
+        std::istringstream s{"1 -2 127 -128"};
+        std::vector<std::int8_t> values(4);
+        GridFormat::AsciiDecoder{}.decode_from(s, std::span{values});
+        expect(std::ranges::equal(values, std::vector<std::int8_t>{1, -2, 127, -128}));
+
+        std::istringstream s2{"1 255"};
+        std::vector<std::uint8_t> values2(2);
+        GridFormat::AsciiDecoder{}.decode_from(s2, std::span{values2});
+        expect(std::ranges::equal(values2, std::vector<std::uint8_t>{1, 255}));
+    };
+
+    "ascii_decoder_floats_stops_at_xml_tag"_test = [] () {
+        std::istringstream s{"1.5 -2e-3 nan\n 4</DataArray> 5 6"};
+        std::vector<double> values(6);
+        expect(eq(GridFormat::AsciiDecoder{}.decode_from(s, std::span{values}), std::size_t{4}));
+        expect(eq(values[0], 1.5));
+        expect(eq(values[1], -2e-3));
+        expect(values[2] != values[2]);
+        expect(eq(values[3], 4.0));
+    };
+
+    "ascii_decoder_chunk_boundaries"_test = [] () {
+        std::vector<double> values(1000);
+        std::ranges::for_each(values, [i=0] (double& v) mutable { v = 1.0/static_cast<double>(++i); });
+        std::ostringstream out;
+        out.precision(17);
+        std::ranges::for_each(values, [&] (double v) { out << v << "  "; });
+
+        for (std::size_t chunk_size : {1, 7, 100, 10000}) {
+            std::istringstream s{out.str()};
+            std::vector<double> read(values.size());
+            const GridFormat::AsciiDecoder decoder{{.chunk_size = chunk_size}};
+            expect(eq(decoder.decode_from(s, std::span{read}), values.size()));
+            expect(std::ranges::equal(read, values));
+        }
+    };
+
+    "ascii_decoder_from_span_stream"_test = [] () {
+        const std::string chars = " 1 -2\n3 </DataArray>";
+        GridFormat::SpanInputStream s{std::span{chars}};
+        std::vector<int> values(5);
+        expect(eq(GridFormat::AsciiDecoder{}.decode_from(s, std::span{values}), std::size_t{3}));
+        expect(std::ranges::equal(std::span{values}.first(3), std::vector<int>{1, -2, 3}));
+
+        std::string rest;
+        s >> rest;
+        expect(eq(rest, std::string{"</DataArray>"}));
+    };
+
+    "ascii_decoder_multithreaded"_test = [] () {
+        std::vector<std::int64_t> values(200'000);
+        std::ranges::for_each(values, [i=std::int64_t{0}] (std::int64_t& v) mutable { v = (i++)*12345 - 1'000'000; });
+        std::ostringstream out;
+        for (std::size_t i = 0; i < values.size(); ++i)
+            out << values[i] << (i%7 == 0 ? "\n" : " ");
+        out << "</DataArray>";
+
+        for (std::size_t num_values : {values.size(), values.size()/2 + 3}) {
+            std::istringstream s{out.str()};
+            std::vector<std::int64_t> read(num_values);
+            const GridFormat::AsciiDecoder decoder{{.num_threads = 4}};
+            expect(eq(decoder.decode_from(s, std::span{read}), num_values));
+            expect(std::ranges::equal(read, std::span{values}.first(num_values)));
+
+            std::int64_t next;
+            if (num_values < values.size() && s >> next)
+                expect(eq(next, values[num_values]));
+        }
+    };
+
+    "ascii_decoder_invalid_values"_test = [] () {
+        std::vector<int> values(3);
+        std::istringstream s1{"1 2.5 3"};
+        expect(throws<GridFormat::ValueError>([&] () { GridFormat::AsciiDecoder{}.decode_from(s1, std::span{values}); }));
+        std::istringstream s2{"1 abc 3"};
+        expect(throws<GridFormat::ValueError>([&] () { GridFormat::AsciiDecoder{}.decode_from(s2, std::span{values}); }));
+        std::vector<std::uint8_t> small_values(1);
+        std::istringstream s3{"256"};
+        expect(throws<GridFormat::ValueError>([&] () { GridFormat::AsciiDecoder{}.decode_from(s3, std::span{small_values}); }));
+    };
+
     return 0;
 }
@@ -5,7 +5,12 @@
 #include <algorithm>
 #include <sstream>
 #include <span>
+#include <string>
+#include <vector>
+#include <random>
+#include <cstddef>
 
+#include <gridformat/common/span_stream.hpp>
 #include <gridformat/encoding/base64.hpp>
 #include "../testing.hpp"
 
@@ -13,6 +18,7 @@ int main() {
     using GridFormat::Testing::operator""_test;
     using GridFormat::Testing::expect;
     using GridFormat::Testing::eq;
+    using GridFormat::Testing::throws;
 
     char in_data[9] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
     std::string expected{"AQIDBAUGBwgJ"};
@@ -47,5 +53,191 @@ int main() {
         expect(std::ranges::equal(decoded, in_data));
     };
 
+    "base64_encoded_stream_with_padding"_test = [&] () {
+        std::ostringstream s1;
+        GridFormat::Encoding::base64(s1).write(std::span{in_data}.first(8));
+        expect(eq(s1.str(), std::string{"AQIDBAUGBwg="}));
+
+        std::ostringstream s2;
+        GridFormat::Encoding::base64(s2).write(std::span{in_data}.first(7));
+        expect(eq(s2.str(), std::string{"AQIDBAUGBw=="}));
+    };
+
+    "base64_encode_kernels"_test = [] () {
+        std::mt19937 gen{42};
+        std::uniform_int_distribution<int> dist{0, 255};
+        std::vector<char> bytes(3*1000);
+        std::ranges::generate(bytes, [&] () { return static_cast<char>(dist(gen)); });
+
+        std::vector<GridFormat::Base64Detail::EncodeKernel> kernels{&GridFormat::Base64Detail::encode};
+#if GRIDFORMAT_HAVE_X86_SIMD_KERNELS
+        if (__builtin_cpu_supports("ssse3"))
+            kernels.push_back(&GridFormat::Base64Detail::encode_ssse3);
+        if (__builtin_cpu_supports("avx2"))
+            kernels.push_back(&GridFormat::Base64Detail::encode_avx2);
+        if (__builtin_cpu_supports("avx512vbmi") && __builtin_cpu_supports("avx512bw"))
+            kernels.push_back(&GridFormat::Base64Detail::encode_avx512vbmi);
+#endif
+        for (std::size_t num_triplets : {0, 1, 5, 6, 9, 10, 16, 17, 31, 33, 1000}) {
+            std::string expected(4*num_triplets, ' ');
+            GridFormat::Base64Detail::encode_scalar(bytes.data(), num_triplets, expected.data());
+            for (const auto& kernel : kernels) {
+                std::string encoded(4*num_triplets, ' ');
+                kernel(bytes.data(), num_triplets, encoded.data());
+                expect(eq(encoded, expected));
+            }
+        }
+    };
+
+    "base64_encoded_stream_large_roundtrip"_test = [] () {
+        std::vector<char> bytes(100'001);
+        std::ranges::generate(bytes, [i=0] () mutable { return static_cast<char>((i++*7)%256); });
+
+        std::ostringstream s;
+        auto stream = GridFormat::Encoding::base64.with({.num_cached_buffers = 100})(s);
+        stream.write(std::span{bytes}.first(3*50));
+        stream.write(std::span{bytes}.subspan(3*50));
+        expect(eq(s.str().size(), GridFormat::Base64::encoded_size(3*50) + GridFormat::Base64::encoded_size(bytes.size() - 3*50)));
+
+        std::vector<char> decoded;
+        std::ranges::copy(s.str(), std::back_inserter(decoded));
+        std::span<char> second_part = std::span{decoded}.subspan(GridFormat::Base64::encoded_size(3*50));
+        const auto num_decoded = GridFormat::Base64Decoder{}.decode(second_part);
+        expect(eq(num_decoded, bytes.size() - 3*50));
+        expect(std::ranges::equal(second_part.first(num_decoded), std::span{bytes}.subspan(3*50)));
+    };
+
+    "base64_decode_kernels"_test = [] () {
+        std::mt19937 gen{42};
+        std::uniform_int_distribution<int> dist{0, 255};
+        std::vector<char> bytes(3*1000);
+        std::ranges::generate(bytes, [&] () { return static_cast<char>(dist(gen)); });
+        std::string encoded(4*1000, ' ');
+        GridFormat::Base64Detail::encode_scalar(bytes.data(), 1000, encoded.data());
+
+        std::vector<GridFormat::Base64Detail::DecodeKernel> kernels{
+            &GridFormat::Base64Detail::decode_scalar,
+            &GridFormat::Base64Detail::decode
+        };
+#if GRIDFORMAT_HAVE_X86_SIMD_KERNELS
+        if (__builtin_cpu_supports("ssse3"))
+            kernels.push_back(&GridFormat::Base64Detail::decode_ssse3);
+        if (__builtin_cpu_supports("avx2"))
+            kernels.push_back(&GridFormat::Base64Detail::decode_avx2);
+        if (__builtin_cpu_supports("avx512vbmi") && __builtin_cpu_supports("avx512bw"))
+            kernels.push_back(&GridFormat::Base64Detail::decode_avx512vbmi);
+#endif
+        for (const auto& kernel : kernels) {
+            for (std::size_t num_quartets : {0, 1, 5, 6, 10, 11, 16, 17, 33, 1000}) {
+                std::vector<char> decoded(3*num_quartets);
+                expect(kernel(encoded.data(), num_quartets, decoded.data()));
+                expect(std::ranges::equal(decoded, std::span{bytes}.first(3*num_quartets)));
+
+                // in-place decoding
+                std::string chars = encoded.substr(0, 4*num_quartets);
+                expect(kernel(chars.data(), num_quartets, chars.data()));
+                expect(std::ranges::equal(std::span{chars}.first(3*num_quartets), std::span{bytes}.first(3*num_quartets)));
+            }
+
+            for (std::size_t invalid_pos : {0, 13, 100, 2047, 3999}) {
+                for (char invalid_char : {'=', '-', ' ', '\n', static_cast<char>(200)}) {
+                    std::string chars = encoded;
+                    chars[invalid_pos] = invalid_char;
+                    std::vector<char> decoded(3*1000);
+                    expect(!kernel(chars.data(), 1000, decoded.data()));
+                }
+            }
+        }
+    };
+
+    "base64_decode_invalid_characters"_test = [] () {
+        std::string chars{"AQID-AUGBwgJ"};
+        expect(throws<GridFormat::ValueError>([&] () { GridFormat::Base64Decoder{}.decode(std::span{chars}); }));
+        chars = "AQIDBAUGB=g=";
+        expect(throws<GridFormat::ValueError>([&] () { GridFormat::Base64Decoder{}.decode(std::span{chars}); }));
+        chars = "AQIDBAUGBwg";
+        expect(throws<GridFormat::SizeError>([&] () { GridFormat::Base64Decoder{}.decode(std::span{chars}); }));
+    };
+
+    "base64_decode_from_stream_with_padded_segments"_test = [&] () {
+        std::ostringstream s;
+        GridFormat::Encoding::base64(s).write(std::span{in_data}.first(8));
+        GridFormat::Encoding::base64(s).write(std::span{in_data}.first(7));
+        GridFormat::Encoding::base64(s).write(std::span{in_data});
+
+        std::istringstream in{s.str() + " some_trailing_chars"};
+        const GridFormat::Base64Decoder decoder;
+        const auto first = decoder.decode_from(in, 8);
+        const auto second = decoder.decode_from(in, 7);
+        const auto third = decoder.decode_from(in, 9);
+        expect(std::ranges::equal(first.as_span_of<char>(), std::span{in_data}.first(8)));
+        expect(std::ranges::equal(second.as_span_of<char>(), std::span{in_data}.first(7)));
+        expect(std::ranges::equal(third.as_span_of<char>(), std::span{in_data}));
+
+        std::string rest;
+        in >> rest;
+        expect(eq(rest, std::string{"some_trailing_chars"}));
+    };
+
+    "base64_decode_from_span_stream_with_padded_segments"_test = [&] () {
+        std::ostringstream s;
+        GridFormat::Encoding::base64(s).write(std::span{in_data}.first(8));
+        GridFormat::Encoding::base64(s).write(std::span{in_data}.first(7));
+        GridFormat::Encoding::base64(s).write(std::span{in_data});
+
+        const std::string encoded = s.str() + " some_trailing_chars";
+        GridFormat::SpanInputStream in{std::span{encoded}};
+        const GridFormat::Base64Decoder decoder;
+        const auto first = decoder.decode_from(in, 8);
+        const auto second = decoder.decode_from(in, 7);
+        const auto third = decoder.decode_from(in, 9);
+        expect(std::ranges::equal(first.as_span_of<char>(), std::span{in_data}.first(8)));
+        expect(std::ranges::equal(second.as_span_of<char>(), std::span{in_data}.first(7)));
+        expect(std::ranges::equal(third.as_span_of<char>(), std::span{in_data}));
+
+        std::string rest;
+        in >> rest;
+        expect(eq(rest, std::string{"some_trailing_chars"}));
+    };
+
+    "base64_decode_from_stream_with_less_padding_than_requested"_test = [&] () {
+        // if the data is not padded, more bytes than requested are decoded
+        std::istringstream in{"AQIDBAUGBwgJ"};
+        const auto decoded = GridFormat::Base64Decoder{}.decode_from(in, 8);
+        expect(std::ranges::equal(decoded.as_span_of<char>(), std::span{in_data}));
+    };
+
+    "base64_decode_from_stream_into_buffer"_test = [&] () {
+        std::vector<char> large(1 << 20);
+        std::ranges::for_each(large, [i=0] (char& c) mutable { c = static_cast<char>(i++%251); });
+        std::ostringstream s;
+        GridFormat::Encoding::base64(s).write(std::span{in_data}.first(7));
+        GridFormat::Encoding::base64(s).write(std::span{large});
+        const std::string encoded = s.str();
+
+        std::vector<char> out(7);
+        std::vector<char> large_out(large.size());
+        const GridFormat::Base64Decoder decoder;
+
+        std::istringstream in{encoded};
+        decoder.decode_from(in, std::as_writable_bytes(std::span{out}));
+        decoder.decode_from(in, std::as_writable_bytes(std::span{large_out}));
+        expect(std::ranges::equal(out, std::span{in_data}.first(7)));
+        expect(std::ranges::equal(large_out, large));
+
+        GridFormat::SpanInputStream span_in{std::span{encoded}};
+        std::ranges::fill(large_out, 0);
+        decoder.decode_from(span_in, std::as_writable_bytes(std::span{out}));
+        decoder.decode_from(span_in, std::as_writable_bytes(std::span{large_out}));
+        expect(std::ranges::equal(out, std::span{in_data}.first(7)));
+        expect(std::ranges::equal(large_out, large));
+
+        // buffers that do not match the size of the encoded data
+        std::istringstream unpadded{"AQIDBAUGBwgJ"};
+        expect(throws<GridFormat::SizeError>([&] () {
+            decoder.decode_from(unpadded, std::as_writable_bytes(std::span{out}.first(2)));
+        }));
+    };
+
     return 0;
 }
@@ -0,0 +1,206 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <future>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+#include <algorithm>
+
+#include <gridformat/common/exceptions.hpp>
+#include <gridformat/grid/writer.hpp>
+#include <gridformat/grid/async_writer.hpp>
+#include <gridformat/vtk/vtu_writer.hpp>
+
+#include "unstructured_grid.hpp"
+#include "../testing.hpp"
+
+using Values = std::vector<double>;
+
+struct Recordings {
+    std::map<std::string, Values> values;
+    std::shared_future<void> release;
+    mutable std::mutex mutex;
+
+    void record(const std::string& name, Values v) {
+        std::lock_guard lock{mutex};
+        values[name] = std::move(v);
+    }
+};
+
+template<typename Writer>
+Values point_values(const Writer& writer) {
+    Values result;
+    for (const auto& [_, field_ptr] : point_fields(writer))
+        std::ranges::copy(field_ptr->serialized().template as_span_of<double>(), std::back_inserter(result));
+    for (const auto& [_, field_ptr] : meta_data_fields(writer))
+        std::ranges::copy(field_ptr->serialized().template as_span_of<double>(), std::back_inserter(result));
+    return result;
+}
+
+template<typename Grid>
+class RecordingWriter : public GridFormat::GridWriter<Grid> {
+    using ParentType = GridFormat::GridWriter<Grid>;
+
+ public:
+    explicit RecordingWriter(const Grid& grid, Recordings& recordings)
+    : ParentType(grid, ".rec", GridFormat::WriterOptions{false, false})
+    , _recordings{&recordings}
+    {}
+
+ private:
+    void _write(const std::string& filename) const override {
+        if (_recordings->release.valid())
+            _recordings->release.wait();
+        if (filename == "fail.rec")
+            throw GridFormat::IOError("Could not write");
+        _recordings->record(filename, point_values(*this));
+    }
+
+    void _write(std::ostream&) const override {
+        throw GridFormat::InvalidState("This test should not call _write(std::ostream&)");
+    }
+
+    Recordings* _recordings;
+};
+
+template<typename Grid>
+class RecordingTimeSeriesWriter : public GridFormat::TimeSeriesGridWriter<Grid> {
+    using ParentType = GridFormat::TimeSeriesGridWriter<Grid>;
+
+ public:
+    explicit RecordingTimeSeriesWriter(const Grid& grid, Recordings& recordings)
+    : ParentType(grid, GridFormat::WriterOptions{false, false})
+    , _recordings{&recordings}
+    {}
+
+ private:
+    std::string _write(double t) override {
+        std::string name = "step_" + std::to_string(this->_step_count) + "_" + std::to_string(static_cast<int>(t));
+        _recordings->record(name, point_values(*this));
+        return name;
+    }
+
+    Recordings* _recordings;
+};
+
+std::string read_file(const std::string& filename) {
+    std::ifstream file{filename, std::ios::binary};
+    return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+int main() {
+    using GridFormat::Testing::operator""_test;
+    using GridFormat::Testing::throws;
+    using GridFormat::Testing::expect;
+    using GridFormat::Testing::eq;
+
+    const auto grid = GridFormat::Test::make_unstructured_2d();
+    const auto num_points = GridFormat::number_of_points(grid);
+
+    "async_writer_writes_snapshot_of_fields"_test = [&] () {
+        Recordings recordings;
+        GridFormat::AsyncWriter writer{RecordingWriter{grid, recordings}};
+        double value = 1.0;
+        writer.set_point_field("p", [&] (const auto&) { return value; });
+        writer.set_meta_data("m", std::vector<double>{42.0});
+
+        auto first = writer.write("first");
+        value = 2.0;
+        auto second = writer.write("second");
+        value = 3.0;
+        expect(eq(first.get(), std::string{"first.rec"}));
+        expect(eq(second.get(), std::string{"second.rec"}));
+
+        Values expected_first(num_points, 1.0); expected_first.push_back(42.0);
+        Values expected_second(num_points, 2.0); expected_second.push_back(42.0);
+        expect(std::ranges::equal(recordings.values.at("first.rec"), expected_first));
+        expect(std::ranges::equal(recordings.values.at("second.rec"), expected_second));
+    };
+
+    "async_writer_takes_over_fields_of_wrapped_writer"_test = [&] () {
+        Recordings recordings;
+        RecordingWriter wrapped{grid, recordings};
+        wrapped.set_point_field("p", [&] (const auto&) { return 5.0; });
+        GridFormat::AsyncWriter writer{std::move(wrapped)};
+        expect(eq(std::ranges::distance(point_fields(writer)), std::ptrdiff_t{1}));
+        writer.write("out").get();
+        expect(std::ranges::equal(recordings.values.at("out.rec"), Values(num_points, 5.0)));
+    };
+
+    "async_writer_applies_back_pressure"_test = [&] () {
+        Recordings recordings;
+        std::promise<void> release;
+        recordings.release = release.get_future().share();
+
+        GridFormat::AsyncWriter writer{RecordingWriter{grid, recordings}, {.max_pending_writes = 2}};
+        writer.set_point_field("p", [&] (const auto&) { return 1.0; });
+        auto first = writer.write("first");
+        auto second = writer.write("second");
+        expect(eq(writer.number_of_pending_writes(), std::size_t{2}));
+
+        auto third = std::async(std::launch::async, [&] () { return writer.write("third").get(); });
+        expect(third.wait_for(std::chrono::milliseconds{50}) == std::future_status::timeout);
+        release.set_value();
+        expect(eq(third.get(), std::string{"third.rec"}));
+        writer.wait();
+        expect(eq(writer.number_of_pending_writes(), std::size_t{0}));
+        expect(eq(recordings.values.size(), std::size_t{3}));
+    };
+
+    "async_writer_forwards_exceptions"_test = [&] () {
+        Recordings recordings;
+        GridFormat::AsyncWriter writer{RecordingWriter{grid, recordings}};
+        auto failed = writer.write("fail");
+        expect(throws<GridFormat::IOError>([&] () { failed.get(); }));
+        expect(eq(writer.write("ok").get(), std::string{"ok.rec"}));
+    };
+
+    "async_time_series_writer"_test = [&] () {
+        Recordings recordings;
+        GridFormat::AsyncWriter writer{RecordingTimeSeriesWriter{grid, recordings}, {.max_pending_writes = 3}};
+        double value = 0.0;
+        writer.set_point_field("p", [&] (const auto&) { return value; });
+        std::vector<std::future<std::string>> futures;
+        for (int i = 0; i < 5; ++i) {
+            value = static_cast<double>(i);
+            futures.push_back(writer.write(static_cast<double>(i*10)));
+        }
+        for (int i = 0; i < 5; ++i) {
+            const auto name = "step_" + std::to_string(i) + "_" + std::to_string(i*10);
+            expect(eq(futures[i].get(), name));
+            expect(std::ranges::equal(recordings.values.at(name), Values(num_points, static_cast<double>(i))));
+        }
+    };
+
+    "async_writer_output_matches_synchronous_writer"_test = [&] () {
+        std::vector<double> values(num_points, 1.0);
+        const auto set_fields = [&] (auto& w) {
+            w.set_point_field("p", [&] (const auto& p) { return values[p.id]; });
+            w.set_cell_field("c", [&] (const auto& c) { return static_cast<double>(c.id); });
+        };
+
+        GridFormat::VTUWriter sync_writer{grid};
+        set_fields(sync_writer);
+        const auto sync_filename = sync_writer.write("async_writer_sync");
+
+        GridFormat::AsyncWriter async_writer{GridFormat::VTUWriter{grid}};
+        set_fields(async_writer);
+        auto async_filename = async_writer.write("async_writer_async");
+        std::ranges::fill(values, 2.0);
+        expect(eq(read_file(sync_filename), read_file(async_filename.get())));
+    };
+
+    "async_writer_requires_positive_queue_depth"_test = [&] () {
+        Recordings recordings;
+        expect(throws<GridFormat::ValueError>([&] () {
+            GridFormat::AsyncWriter writer{RecordingWriter{grid, recordings}, {.max_pending_writes = 0}};
+        }));
+    };
+
+    return 0;
+}
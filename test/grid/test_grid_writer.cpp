@@ -1,11 +1,14 @@
 // SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
 // SPDX-License-Identifier: MIT
 
+#include <span>
+#include <array>
 #include <vector>
 #include <sstream>
 #include <iterator>
 #include <type_traits>
 #include <algorithm>
+#include <cstddef>
 #include <utility>
 #include <vector>
 
@@ -217,6 +220,45 @@ int main() {
         );
     };
 
+    "grid_writer_entity_fields_evaluated_on_multiple_threads"_test = [&] () {
+        static_assert(std::ranges::random_access_range<decltype(GridFormat::points(grid))>);
+        const auto point_values = make_point_values(grid);
+        const auto cell_values = make_cell_values(grid);
+        MyWriter writer{grid};
+        writer.set_entity_field_options({.num_threads = 3, .chunk_size = 1});
+        writer.set_point_field("test", [&] (const auto& point) { return point_values[point.id]; });
+        writer.set_cell_field("test", [&] (const auto& cell) { return cell_values[cell.id]; });
+        writer.set_point_field("vector", [&] (const auto& point) {
+            return std::array<double, 2>{static_cast<double>(point.id), 1.0};
+        });
+        check_serialization(writer.get_point_field("test"), make_point_values_sorted_by_grid(grid));
+        check_serialization(writer.get_cell_field("test"), make_cell_values_sorted_by_grid(grid));
+
+        std::vector<double> vector_values;
+        std::ranges::for_each(GridFormat::points(grid), [&] (const auto& point) {
+            vector_values.push_back(static_cast<double>(point.id));
+            vector_values.push_back(1.0);
+        });
+        check_serialization(writer.get_point_field("vector"), vector_values);
+    };
+
+    "grid_writer_entity_fields_serialized_in_chunks"_test = [&] () {
+        MyWriter writer{grid};
+        writer.set_entity_field_options({.num_threads = 2, .chunk_size = 1});
+        writer.set_point_field("vector", [&] (const auto& point) {
+            return std::array<double, 2>{static_cast<double>(point.id), 1.0};
+        });
+        const auto& field = writer.get_point_field("vector");
+        const auto serialization = field.serialized();
+        const auto bytes = serialization.as_span();
+        std::vector<std::byte> chunk(bytes.size());
+        for (std::size_t offset = 0; offset < bytes.size(); offset += 3) {
+            const std::size_t size = std::min(std::size_t{5}, bytes.size() - offset);
+            field.serialize_bytes_into(offset, std::span{chunk}.first(size));
+            expect(std::ranges::equal(std::span{chunk}.first(size), bytes.subspan(offset, size)));
+        }
+    };
+
     "writer_set_custom_point_field"_test = [&] () {
         MyWriter writer{grid};
         writer.set_point_field("test", MyField{make_point_values(grid)});
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include <ranges>
+#include <vector>
 #include <algorithm>
 
 #include <gridformat/common/exceptions.hpp>
@@ -63,6 +64,33 @@ void check_grid(const Grid& grid) {
     }
 }
 
+template<typename Grid>
+void check_point_id_map(const Grid& grid, GridFormat::PointIdMap::Storage expected_storage) {
+    using GridFormat::Testing::expect;
+    using GridFormat::Testing::throws;
+    using GridFormat::Testing::eq;
+
+    const auto map = GridFormat::make_point_id_map(grid);
+    expect(map.storage() == expected_storage);
+    expect(eq(map.size(), grid.points().size()));
+
+    std::size_t i = 0;
+    std::size_t max_id = 0;
+    for (const auto& p : GridFormat::points(grid)) {
+        expect(eq(map.at(GridFormat::id(grid, p)), i++));
+        max_id = std::max(max_id, p.id);
+    }
+    expect(throws<GridFormat::ValueError>([&] () { map.at(max_id + 1); }));
+}
+
+template<typename Grid>
+auto make_with_scaled_point_ids(const Grid& grid, std::size_t factor) {
+    auto points = grid.points();
+    auto cells = grid.cells();
+    std::ranges::for_each(points, [&] (auto& p) { p.id *= factor; });
+    return Grid{std::move(points), std::move(cells), false};
+}
+
 int main() {
     using GridFormat::Testing::operator""_test;
     "unstructured_grid_0d_in_1d"_test = [] () { check_grid(GridFormat::Test::make_unstructured_0d<1>());  };
@@ -78,5 +106,19 @@ int main() {
 
     "unstructured_grid_3d"_test = [] () { check_grid(GridFormat::Test::make_unstructured_2d<3>());  };
 
+    "point_id_map"_test = [] () {
+        using Storage = GridFormat::PointIdMap::Storage;
+        const auto grid = GridFormat::Test::make_unstructured_2d<2>();
+        std::vector<GridFormat::Test::Point<2>> sorted_points{grid.points()};
+        std::ranges::sort(sorted_points, {}, [] (const auto& p) { return p.id; });
+        const auto identity_grid = GridFormat::Test::UnstructuredGrid<2, 2>{
+            std::move(sorted_points), {}, false
+        };
+        check_point_id_map(identity_grid, Storage::identity);
+        check_point_id_map(grid, Storage::dense);
+        check_point_id_map(make_with_scaled_point_ids(grid, 2), Storage::dense);
+        check_point_id_map(make_with_scaled_point_ids(grid, 1000), Storage::sparse);
+    };
+
     return 0;
 }
@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+
+#include <mpi.h>
+
+#include <array>
+#include <span>
+#include <vector>
+#include <ranges>
+#include <cstddef>
+#include <algorithm>
+
+#include <gridformat/parallel/aggregation.hpp>
+#include "../testing.hpp"
+
+int main(int argc, char** argv) {
+    MPI_Init(&argc, &argv);
+
+    using GridFormat::Testing::operator""_test;
+    using GridFormat::Testing::expect;
+    using GridFormat::Testing::eq;
+
+    "null_communicator_aggregation"_test = [] () {
+        const GridFormat::Parallel::Aggregation aggregation{GridFormat::NullCommunicator{}, 4};
+        expect(aggregation.is_aggregator());
+        expect(eq(aggregation.number_of_groups(), 1));
+        expect(std::ranges::equal(aggregation.gather(std::vector{1, 2}), std::vector{1, 2}));
+    };
+
+    const int rank = GridFormat::Parallel::rank(MPI_COMM_WORLD);
+    const int size = GridFormat::Parallel::size(MPI_COMM_WORLD);
+    for (const int ranks_per_aggregator : {1, 2, 3}) {
+        const GridFormat::Parallel::Aggregation aggregation{MPI_COMM_WORLD, static_cast<std::size_t>(ranks_per_aggregator)};
+        const int my_aggregator = rank - rank%ranks_per_aggregator;
+        const int group_end = std::min(my_aggregator + ranks_per_aggregator, size);
+
+        "mpi_aggregation_groups"_test = [&] () {
+            expect(eq(aggregation.aggregator(), my_aggregator));
+            expect(eq(aggregation.is_aggregator(), rank == my_aggregator));
+            expect(std::ranges::equal(aggregation.group(), std::views::iota(my_aggregator, group_end)));
+            expect(eq(aggregation.number_of_groups(), (size + ranks_per_aggregator - 1)/ranks_per_aggregator));
+            expect(std::ranges::all_of(aggregation.aggregators(), [&] (int r) { return r%ranks_per_aggregator == 0; }));
+        };
+
+        "mpi_aggregation_gather"_test = [&] () {
+            // each rank contributes as many values as its rank
+            const std::vector<double> my_values(rank, static_cast<double>(rank));
+            const auto gathered = aggregation.gather(my_values);
+            std::vector<double> expected;
+            if (aggregation.is_aggregator())
+                for (int r = my_aggregator; r < group_end; ++r)
+                    expected.insert(expected.end(), r, static_cast<double>(r));
+            expect(std::ranges::equal(gathered, expected));
+
+            const auto gathered_bytes = aggregation.gather(std::as_bytes(std::span{my_values}));
+            expect(eq(gathered_bytes.size(), expected.size()*sizeof(double)));
+
+            const auto gathered_array = aggregation.gather(std::array<std::size_t, 2>{std::size_t(rank), 42});
+            expect(eq(gathered_array.size(), aggregation.is_aggregator() ? 2*std::size_t(group_end - my_aggregator) : 0));
+        };
+    }
+
+    MPI_Finalize();
+    return 0;
+}
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
+// SPDX-License-Identifier: MIT
+
+#include <list>
+#include <string>
+#include <vector>
+#include <sstream>
+#include <cstdint>
+#include <algorithm>
+#include <streambuf>
+
+#include <gridformat/common/range_field.hpp>
+#include <gridformat/common/precision.hpp>
+#include <gridformat/compression/zlib.hpp>
+#include <gridformat/encoding/base64.hpp>
+#include <gridformat/encoding/raw.hpp>
+#include <gridformat/vtk/data_array.hpp>
+
+#include "../testing.hpp"
+
+// stream buffer that does not support seeking (such that tellp() fails)
+class NonSeekableBuffer : public std::streambuf {
+ public:
+    const std::string& str() const { return _data; }
+
+ protected:
+    int_type overflow(int_type c) override {
+        if (!traits_type::eq_int_type(c, traits_type::eof()))
+            _data.push_back(traits_type::to_char_type(c));
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        _data.append(s, n);
+        return n;
+    }
+
+ private:
+    std::string _data;
+};
+
+template<typename Encoder, typename Compressor, typename HeaderType>
+void check_pipelined_output(const GridFormat::VTK::DataArray<Encoder, Compressor, HeaderType>& array) {
+    using GridFormat::Testing::expect;
+    using GridFormat::Testing::eq;
+
+    std::ostringstream seekable;
+    seekable << "some_prefix ";
+    array.stream(seekable);
+    seekable << " some_suffix";
+
+    NonSeekableBuffer buffer;
+    std::ostream non_seekable{&buffer};
+    non_seekable << "some_prefix ";
+    array.stream(non_seekable);
+    non_seekable << " some_suffix";
+
+    expect(eq(seekable.str(), buffer.str()));
+}
+
+int main() {
+    using GridFormat::Testing::operator""_test;
+
+    std::vector<double> values(1000);
+    std::ranges::for_each(values, [i=0] (double& v) mutable { v = static_cast<double>((i++)%17); });
+    const GridFormat::RangeField field{values};
+
+    "data_array_pipelined_compression_base64"_test = [&] () {
+        for (std::size_t block_size : {7, 64, 100, 1000, 10000})
+            for (std::size_t num_threads : {1, 3})
+                check_pipelined_output(GridFormat::VTK::DataArray{
+                    field,
+                    GridFormat::Encoding::base64,
+                    GridFormat::Compression::ZLIB{{.block_size = block_size, .num_threads = num_threads}},
+                    GridFormat::uint32
+                });
+    };
+
+    "data_array_pipelined_compression_raw"_test = [&] () {
+        for (std::size_t block_size : {7, 100, 10000})
+            check_pipelined_output(GridFormat::VTK::DataArray{
+                field,
+                GridFormat::Encoding::raw,
+                GridFormat::Compression::ZLIB{{.block_size = block_size}},
+                GridFormat::uint64
+            });
+    };
+
+    "data_array_output_independent_of_contiguous_field_data"_test = [&] () {
+        using GridFormat::Testing::expect;
+        using GridFormat::Testing::eq;
+        const std::list<double> list_values{values.begin(), values.end()};
+        const GridFormat::RangeField list_field{list_values};
+        expect(field.contiguous_bytes().has_value());
+        expect(!list_field.contiguous_bytes().has_value());
+
+        const auto write = [] (const auto& f, std::ostream& s) {
+            GridFormat::VTK::DataArray{
+                f,
+                GridFormat::Encoding::base64,
+                GridFormat::Compression::ZLIB{{.block_size = 100}},
+                GridFormat::uint32
+            }.stream(s);
+            GridFormat::VTK::DataArray{f, GridFormat::Encoding::raw, GridFormat::none, GridFormat::uint32}.stream(s);
+        };
+
+        std::ostringstream from_contiguous, from_list;
+        write(field, from_contiguous);
+        write(list_field, from_list);
+        expect(eq(from_contiguous.str(), from_list.str()));
+
+        NonSeekableBuffer contiguous_buffer, list_buffer;
+        std::ostream non_seekable_contiguous{&contiguous_buffer}, non_seekable_list{&list_buffer};
+        write(field, non_seekable_contiguous);
+        write(list_field, non_seekable_list);
+        expect(eq(contiguous_buffer.str(), list_buffer.str()));
+    };
+
+    return 0;
+}
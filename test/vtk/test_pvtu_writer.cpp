@@ -3,11 +3,18 @@
 
 #include <mpi.h>
 
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
 #include <gridformat/parallel/communication.hpp>
 #include <gridformat/vtk/pvtu_writer.hpp>
+#include <gridformat/vtk/pvtu_reader.hpp>
 
 #include "../grid/unstructured_grid.hpp"
 #include "../make_test_data.hpp"
+#include "../testing.hpp"
 #include "vtk_writer_tester.hpp"
 
 
@@ -23,6 +30,70 @@ int main(int argc, char** argv) {
         return GridFormat::PVTUWriter{grid, MPI_COMM_WORLD, opts};
     });
 
+    // write the pieces of all ranks into a single file and compare with the output of one file per rank
+    const int rank = GridFormat::Parallel::rank(MPI_COMM_WORLD);
+    const auto grid = GridFormat::Test::make_unstructured_2d(rank);
+    for (const std::size_t ranks_per_piece : {std::size_t{1}, std::size_t{2}}) {
+        GridFormat::PVTUWriter writer{grid, MPI_COMM_WORLD, {.ranks_per_piece = ranks_per_piece}};
+        GridFormat::Test::write_test_file<2>(
+            writer, "_pvtu_2d_in_2d_ranks_per_piece_" + std::to_string(ranks_per_piece), {}, rank == 0
+        );
+    }
+    {  // with a static grid, the second write reuses the grid arrays gathered in the first one
+        GridFormat::PVTUWriter writer{grid, MPI_COMM_WORLD, {.static_grid = true, .ranks_per_piece = 2}};
+        for (int i = 0; i < 2; ++i)
+            GridFormat::Test::write_test_file<2>(writer, "_pvtu_2d_in_2d_ranks_per_piece_2_static_grid", {}, rank == 0);
+    }
+    GridFormat::Parallel::barrier(MPI_COMM_WORLD);
+
+    if (rank == 0) {
+        using GridFormat::Testing::operator""_test;
+        using GridFormat::Testing::expect;
+        using GridFormat::Testing::eq;
+
+        GridFormat::PVTUReader reader;
+        reader.open("_pvtu_2d_in_2d_ranks_per_piece_1.pvtu");
+        for (const std::string suffix : {"", "_static_grid"}) {
+            GridFormat::PVTUReader aggregated_reader;
+            aggregated_reader.open("_pvtu_2d_in_2d_ranks_per_piece_2" + suffix + ".pvtu");
+
+            "pvtu_aggregated_pieces"_test = [&] () {
+                expect(eq(reader.number_of_pieces(), std::size_t{2}));
+                expect(eq(aggregated_reader.number_of_pieces(), std::size_t{1}));
+                expect(eq(reader.number_of_points(), aggregated_reader.number_of_points()));
+                expect(eq(reader.number_of_cells(), aggregated_reader.number_of_cells()));
+            };
+
+            "pvtu_aggregated_pieces_grid"_test = [&] () {
+                const auto get_cells = [] (const auto& r) {
+                    std::vector<std::vector<std::size_t>> result;
+                    r.visit_cells([&] (GridFormat::CellType, const std::vector<std::size_t>& corners) {
+                        result.push_back(corners);
+                    });
+                    return result;
+                };
+                expect(get_cells(reader) == get_cells(aggregated_reader));
+                expect(std::ranges::equal(
+                    reader.points()->template export_to<std::vector<double>>(),
+                    aggregated_reader.points()->template export_to<std::vector<double>>()
+                ));
+            };
+
+            "pvtu_aggregated_pieces_fields"_test = [&] () {
+                for (const auto& [name, field] : point_fields(reader))
+                    expect(std::ranges::equal(
+                        field->template export_to<std::vector<double>>(),
+                        aggregated_reader.point_field(name)->template export_to<std::vector<double>>()
+                    ));
+                for (const auto& [name, field] : cell_fields(reader))
+                    expect(std::ranges::equal(
+                        field->template export_to<std::vector<double>>(),
+                        aggregated_reader.cell_field(name)->template export_to<std::vector<double>>()
+                    ));
+            };
+        }
+    }
+
     MPI_Finalize();
     return 0;
 }
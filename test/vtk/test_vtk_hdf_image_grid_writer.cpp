@@ -3,6 +3,7 @@
 
 #include <iostream>
 #include <numbers>
+#include <utility>
 
 #include <gridformat/common/logging.hpp>
 #include <gridformat/vtk/hdf_writer.hpp>
@@ -11,13 +12,13 @@
 #include "../make_test_data.hpp"
 
 template<typename Grid>
-void _test(Grid&& grid, const std::string& filename) {
+void _test(Grid&& grid, const std::string& filename, GridFormat::HDF5::DataSetOptions dataset_opts = {}) {
     // TODO: There is a (fixed) issue in the vtkHDFReader when reading cell arrays from image grids:
     //       see https://gitlab.kitware.com/vtk/vtk/-/issues/18860
     //       Once this is in a release version we should also add cell data
     // TODO: There is an issue with field data (https://gitlab.kitware.com/vtk/vtk/-/issues/19030)
     //       Once fixed, add meta data as well
-    GridFormat::VTKHDFWriter writer{grid};
+    GridFormat::VTKHDFWriter writer{grid, std::move(dataset_opts)};
     GridFormat::Test::write_test_file<GridFormat::dimension<Grid>>(
         writer,
         filename,
@@ -49,6 +50,12 @@ int main() {
                     + "_" + std::to_string(nz)
                 );
 
+    _test(
+        GridFormat::Test::StructuredGrid<3>({{1.0, 1.0, 1.0}}, {{2, 3, 4}}),
+        "vtk_hdf_image_3d_in_3d_compressed",
+        {.chunk_size = 2, .shuffle = true, .deflate_level = 6}
+    );
+
     // TODO: the vtkHDFReader in python, at least the way we use it, does not yield the correct
     //       point coordinates, but still the axis-aligned ones. Interestingly, ParaView correctly
     //       displays the files we produce. Also, we obtain the points of a read .vti files in the
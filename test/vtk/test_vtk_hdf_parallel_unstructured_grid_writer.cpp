@@ -30,6 +30,27 @@ int main(int argc, char** argv) {
         );
     }
 
+    {
+        const auto grid = GridFormat::Test::make_unstructured_3d();
+        GridFormat::VTKHDFWriter writer{grid, MPI_COMM_WORLD, GridFormat::HDF5::DataSetOptions{
+            .shuffle = true,
+            .deflate_level = 6
+        }};
+        GridFormat::Test::write_test_file<3>(
+            writer, "pvtk_3d_in_3d_parallel_unstructured_compressed_nranks_" + std::to_string(size)
+        );
+    }
+
+    {
+        const auto grid = GridFormat::Test::make_unstructured_3d();
+        GridFormat::VTKHDFWriter writer{grid, MPI_COMM_WORLD, GridFormat::HDF5::DataSetOptions{
+            .aggregators_per_node = 1
+        }};
+        GridFormat::Test::write_test_file<3>(
+            writer, "pvtk_3d_in_3d_parallel_unstructured_aggregated_nranks_" + std::to_string(size)
+        );
+    }
+
     MPI_Finalize();
 
     return 0;
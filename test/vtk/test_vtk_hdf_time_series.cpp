@@ -1,6 +1,10 @@
 // SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
 // SPDX-License-Identifier: MIT
 
+#include <string>
+#include <vector>
+#include <algorithm>
+
 #include <gridformat/common/hdf5.hpp>
 #include <gridformat/common/ranges.hpp>
 #include <gridformat/common/logging.hpp>
@@ -81,6 +85,84 @@ int main() {
         };
     }
 
+    {  // test with custom chunk geometry and chunk cache
+        const auto grid = GridFormat::Test::make_unstructured<2, 2>();
+        const std::string base_filename = "vtk_hdf_time_series_2d_in_2d_unstructured_static_grid_chunked";
+        for (const auto growth : {GridFormat::VTK::HDFChunkGrowth::across_steps, GridFormat::VTK::HDFChunkGrowth::per_step}) {
+            GridFormat::VTKHDFTimeSeriesWriter writer{
+                grid,
+                base_filename + (growth == GridFormat::VTK::HDFChunkGrowth::per_step ? "_per_step" : "_across_steps"),
+                GridFormat::VTK::HDFTransientOptions{
+                    .static_grid = true,
+                    .static_meta_data = true,
+                    .chunk_size_in_bytes = 100,
+                    .chunk_growth = growth,
+                    .chunk_cache_size_in_bytes = 1 << 10
+                }
+            };
+            GridFormat::Test::write_test_time_series<2>(writer);
+        }
+
+        "hdf_time_series_chunked_matches_default_chunking"_test = [&] () {
+            GridFormat::HDF5::File file{"vtk_hdf_time_series_2d_in_2d_unstructured_static_grid.hdf"};
+            for (const std::string suffix : {"_per_step", "_across_steps"}) {
+                GridFormat::HDF5::File chunked_file{
+                    base_filename + suffix + ".hdf",
+                    GridFormat::HDF5::File<>::read_only,
+                    {.chunk_cache_size_in_bytes = 1 << 10}
+                };
+                for (const std::string path : {
+                    "/VTKHDF/Steps/CellOffsets",
+                    "/VTKHDF/PointData/pscalar",
+                    "/VTKHDF/CellData/cvector"
+                }) {
+                    expect(std::ranges::equal(file.get_dimensions(path).value(), chunked_file.get_dimensions(path).value()));
+                    expect(std::ranges::equal(
+                        file.read_dataset_to<std::vector<double>>(path),
+                        chunked_file.read_dataset_to<std::vector<double>>(path)
+                    ));
+                }
+            }
+        };
+    }
+
+    {  // test with a file that is kept open between the steps
+        const auto grid = GridFormat::Test::make_unstructured<2, 2>();
+        for (const bool static_grid : {false, true}) {
+            GridFormat::VTKHDFTimeSeriesWriter writer{
+                grid,
+                std::string{"vtk_hdf_time_series_2d_in_2d_unstructured_kept_open"} + (static_grid ? "_static_grid" : ""),
+                GridFormat::VTK::HDFTransientOptions{
+                    .static_grid = static_grid,
+                    .static_meta_data = static_grid,
+                    .keep_file_open = true,
+                    .flush_interval = 2
+                }
+            };
+            GridFormat::Test::write_test_time_series<2>(writer);
+        }
+
+        "hdf_time_series_kept_open_matches_reopened_file"_test = [&] () {
+            for (const std::string suffix : {"", "_static_grid"}) {
+                GridFormat::HDF5::File file{"vtk_hdf_time_series_2d_in_2d_unstructured" + suffix + ".hdf"};
+                GridFormat::HDF5::File kept_open_file{"vtk_hdf_time_series_2d_in_2d_unstructured_kept_open" + suffix + ".hdf"};
+                for (const std::string path : {
+                    "/VTKHDF/Steps/PointOffsets",
+                    "/VTKHDF/Steps/CellOffsets",
+                    "/VTKHDF/Steps/ConnectivityIdOffsets",
+                    "/VTKHDF/Steps/PartOffsets",
+                    "/VTKHDF/Connectivity",
+                    "/VTKHDF/PointData/pscalar"
+                }) {
+                    expect(std::ranges::equal(
+                        file.read_dataset_to<std::vector<double>>(path),
+                        kept_open_file.read_dataset_to<std::vector<double>>(path)
+                    ));
+                }
+            }
+        };
+    }
+
     {
         const GridFormat::Test::StructuredGrid<2> grid{
             {1.0, 1.0},
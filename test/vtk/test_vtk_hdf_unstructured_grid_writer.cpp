@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: MIT
 
 #include <vector>
+#include <cstdint>
+#include <algorithm>
 
 #include <gridformat/vtk/hdf_writer.hpp>
 
@@ -23,6 +25,46 @@ int main() {
         GridFormat::Test::write_test_file<3>(writer, "vtk_hdf_unstructured_3d_in_3d");
     }
 
+    {
+        const auto grid = GridFormat::Test::make_unstructured_3d();
+        GridFormat::VTKHDFWriter writer{grid, GridFormat::HDF5::DataSetOptions{
+            .chunk_size = 5,
+            .shuffle = true,
+            .deflate_level = 6
+        }};
+        GridFormat::Test::write_test_file<3>(writer, "vtk_hdf_unstructured_3d_in_3d_compressed");
+    }
+
+    {  // topology arrays are written with 32-bit ids if they fit
+        using GridFormat::Testing::expect;
+        using GridFormat::Testing::operator""_test;
+
+        const auto grid = GridFormat::Test::make_unstructured_3d();
+        GridFormat::VTKHDFWriter{grid}.write("vtk_hdf_unstructured_3d_in_3d_topology");
+
+        "vtk_hdf_unstructured_topology_uses_32bit_ids"_test = [&] () {
+            const GridFormat::HDF5::File file{"vtk_hdf_unstructured_3d_in_3d_topology.hdf"};
+            const GridFormat::DynamicPrecision int32{GridFormat::Precision<std::int32_t>{}};
+            expect(file.get_precision("/VTKHDF/Connectivity").value() == int32);
+            expect(file.get_precision("/VTKHDF/Offsets").value() == int32);
+            expect(file.get_precision("/VTKHDF/Types").value() == GridFormat::DynamicPrecision{GridFormat::uint8});
+
+            const auto point_id_map = GridFormat::make_point_id_map(grid);
+            const auto connectivity = GridFormat::VTK::make_connectivity_field(grid, point_id_map);
+            const auto offsets = GridFormat::VTK::make_offsets_field(grid);
+            auto expected_offsets = offsets->export_to<std::vector<std::size_t>>();
+            expected_offsets.insert(expected_offsets.begin(), 0);
+            expect(std::ranges::equal(
+                file.read_dataset_to<std::vector<std::size_t>>("/VTKHDF/Connectivity"),
+                connectivity->export_to<std::vector<std::size_t>>()
+            ));
+            expect(std::ranges::equal(
+                file.read_dataset_to<std::vector<std::size_t>>("/VTKHDF/Offsets"),
+                expected_offsets
+            ));
+        };
+    }
+
     {  // unit-test the IOContext helper class
         using GridFormat::Testing::throws;
         using GridFormat::Testing::expect;
@@ -5,8 +5,13 @@
 #include <filesystem>
 #include <iterator>
 #include <ranges>
+#include <memory>
+#include <vector>
+#include <utility>
+#include <algorithm>
 
 #include <gridformat/common/logging.hpp>
+#include <gridformat/common/field_cache.hpp>
 #include <gridformat/vtk/vtu_reader.hpp>
 #include <gridformat/vtk/vtu_writer.hpp>
 
@@ -24,12 +29,110 @@ int main() {
     const auto grid = GridFormat::Test::make_unstructured_2d();
     GridFormat::VTUWriter writer{grid};
     GridFormat::VTUReader reader;
-    GridFormat::Test::test_reader<2, 2>(
+    const auto base64_file = GridFormat::Test::test_reader<2, 2>(
         writer,
         reader,
         "reader_vtu_test_file_2d_in_2d"
     );
 
+    // compare reads of tuple ranges against the corresponding parts of the full field values
+    const auto test_range_reads = [] (const std::string& filename) {
+        using GridFormat::Testing::operator""_test;
+        using GridFormat::Testing::expect;
+        using GridFormat::Testing::eq;
+        "vtu_reader_range_reads"_test = [&] () {
+            GridFormat::VTUReader range_reader;
+            range_reader.open(filename);
+            for (const auto& [_, field_ptr] : point_fields(range_reader)) {
+                const auto full = field_ptr->serialized();
+                const std::size_t num_tuples = field_ptr->layout().extent(0);
+                const std::size_t tuple_size = full.size()/num_tuples;
+                for (const auto& [first, count] : std::vector<std::pair<std::size_t, std::size_t>>{
+                    {0, num_tuples}, {0, 1}, {1, num_tuples - 2}, {num_tuples/2, num_tuples - num_tuples/2}, {num_tuples, 0}
+                }) {
+                    const auto range = field_ptr->serialized_range(first, count);
+                    expect(eq(range.size(), count*tuple_size));
+                    expect(std::ranges::equal(
+                        range.as_span(),
+                        full.as_span().subspan(first*tuple_size, count*tuple_size)
+                    ));
+                }
+            }
+        };
+    };
+    test_range_reads(base64_file);
+
+    GridFormat::VTUWriter ascii_writer{grid, {.encoder = GridFormat::Encoding::ascii}};
+    test_range_reads(GridFormat::Test::test_reader<2, 2>(
+        ascii_writer,
+        reader,
+        "reader_vtu_test_file_2d_in_2d_ascii"
+    ));
+
+    GridFormat::VTUReader mapped_reader{{.memory_map = true}};
+    GridFormat::Test::test_reader<2, 2>(
+        writer,
+        mapped_reader,
+        "reader_vtu_test_file_2d_in_2d_mapped"
+    );
+    GridFormat::Test::test_reader<2, 2>(
+        ascii_writer,
+        mapped_reader,
+        "reader_vtu_test_file_2d_in_2d_ascii_mapped"
+    );
+
+    GridFormat::VTUWriter raw_writer{grid, {.encoder = GridFormat::Encoding::raw}};
+    const auto raw_file = GridFormat::Test::test_reader<2, 2>(
+        raw_writer,
+        mapped_reader,
+        "reader_vtu_test_file_2d_in_2d_raw_mapped"
+    );
+    test_range_reads(raw_file);
+
+    const auto cache = std::make_shared<GridFormat::FieldCache>(std::size_t{1} << 20);
+    GridFormat::VTUReader cached_reader{{.cache = cache}};
+    GridFormat::Test::test_reader<2, 2>(
+        writer,
+        cached_reader,
+        "reader_vtu_test_file_2d_in_2d_cached"
+    );
+    {
+        using GridFormat::Testing::operator""_test;
+        using GridFormat::Testing::expect;
+        "vtu_reader_cache_hits"_test = [&] () {
+            expect(cache->statistics().misses > 0);
+            expect(cache->statistics().hits > 0);
+        };
+    }
+
+#if GRIDFORMAT_HAVE_ZLIB
+    // use small blocks such that (de-)compression is distributed over multiple threads
+    GridFormat::VTUWriter threaded_writer{grid, {
+        .compressor = GridFormat::Compression::ZLIB::with({.block_size = 64, .num_threads = 4})
+    }};
+    GridFormat::VTUReader threaded_reader{{.num_threads = 4}};
+    const auto compressed_file = GridFormat::Test::test_reader<2, 2>(
+        threaded_writer,
+        threaded_reader,
+        "reader_vtu_test_file_2d_in_2d_threaded"
+    );
+    test_range_reads(compressed_file);
+
+    GridFormat::VTUWriter compressed_raw_writer{grid, {
+        .encoder = GridFormat::Encoding::raw,
+        .compressor = GridFormat::Compression::ZLIB::with({.block_size = 64})
+    }};
+    test_range_reads(
+        GridFormat::Test::test_reader<2, 2>(compressed_raw_writer, reader, "reader_vtu_test_file_2d_in_2d_compressed_raw"));
+
+    GridFormat::VTUWriter compressed_inlined_writer{grid, {
+        .compressor = GridFormat::Compression::ZLIB::with({.block_size = 64}),
+        .data_format = GridFormat::VTK::DataFormat::inlined
+    }};
+    test_range_reads(
+        GridFormat::Test::test_reader<2, 2>(compressed_inlined_writer, reader, "reader_vtu_test_file_2d_in_2d_compressed_inlined"));
+#endif
+
     const std::string test_data_path_name{TEST_DATA_PATH};
     if (test_data_path_name.empty()) {
         std::cout << "No test data folder defined, skipping further tests" << std::endl;
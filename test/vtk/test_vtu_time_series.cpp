@@ -1,12 +1,40 @@
 // SPDX-FileCopyrightText: 2022-2023 Dennis Gläser <dennis.glaeser@iws.uni-stuttgart.de>
 // SPDX-License-Identifier: MIT
 
+#include <string>
+#include <fstream>
+#include <iterator>
+
+#include <gridformat/common/exceptions.hpp>
 #include <gridformat/vtk/vtu_writer.hpp>
 #include <gridformat/vtk/xml_time_series_writer.hpp>
 
 #include "../grid/unstructured_grid.hpp"
 #include "../make_test_data.hpp"
 
+std::string read_file(const std::string& filename) {
+    std::ifstream file{filename, std::ios::binary};
+    return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+template<typename Grid>
+void check_static_grid_output(const Grid& grid, const GridFormat::VTK::XMLOptions& opts, const std::string& suffix) {
+    auto static_opts = opts;
+    static_opts.static_grid = true;
+    GridFormat::VTKXMLTimeSeriesWriter writer{GridFormat::VTUWriter{grid, opts}, "vtu_time_series_2d_in_2d_" + suffix};
+    GridFormat::VTKXMLTimeSeriesWriter static_writer{
+        GridFormat::VTUWriter{grid, static_opts}, "vtu_time_series_2d_in_2d_" + suffix + "_static_grid"
+    };
+    GridFormat::Test::write_test_time_series<2>(writer, 3);
+    GridFormat::Test::write_test_time_series<2>(static_writer, 3);
+    for (const std::string step : {"00000", "00001", "00002"}) {
+        const auto filename = "vtu_time_series_2d_in_2d_" + suffix + "-" + step + ".vtu";
+        const auto static_filename = "vtu_time_series_2d_in_2d_" + suffix + "_static_grid-" + step + ".vtu";
+        if (read_file(filename) != read_file(static_filename))
+            throw GridFormat::ValueError("Output with static grid differs from '" + filename + "'");
+    }
+}
+
 int main() {
     const auto grid = GridFormat::Test::make_unstructured<2, 2>();
     GridFormat::VTKXMLTimeSeriesWriter writer{
@@ -14,5 +42,9 @@ int main() {
         "vtu_time_series_2d_in_2d"
     };
     GridFormat::Test::write_test_time_series<2>(writer);
+
+    check_static_grid_output(grid, {}, "appended");
+    check_static_grid_output(grid, {.encoder = GridFormat::Encoding::ascii, .data_format = GridFormat::VTK::DataFormat::inlined}, "ascii");
+    check_static_grid_output(grid, {.encoder = GridFormat::Encoding::base64, .data_format = GridFormat::VTK::DataFormat::inlined}, "base64");
     return 0;
 }
@@ -6,6 +6,9 @@
 #include <vector>
 #include <string>
 #include <utility>
+#include <fstream>
+#include <iterator>
+#include <filesystem>
 #include <type_traits>
 
 #include <gridformat/common/precision.hpp>
@@ -121,7 +124,17 @@ class WriterTester {
                             .with_encoding(GridFormat::Variant::without<Automatic>(_opts.encoder))
                             .with_compression(GridFormat::Variant::without<Automatic>(_opts.compressor))
                             .with_data_format(GridFormat::Variant::without<Automatic>(_opts.data_format));
-            write_test_file<space_dim>(writer, _make_filename(_opts) + "_modified", {}, _verbose);
+            const auto filename = write_test_file<space_dim>(writer, _make_filename(_opts) + "_modified", {}, _verbose);
+
+            // output must not depend on the number of threads used for preparing the data arrays
+            using Communicator = std::remove_cvref_t<decltype(GridFormat::Traits::CommunicatorAccess<decltype(writer)>::get(writer))>;
+            if constexpr (std::is_same_v<Communicator, GridFormat::NullCommunicator>) {
+                auto threaded_writer = factory(_grid, _opts).with_threads(3);
+                const auto threaded_filename = write_test_file<space_dim>(threaded_writer, _make_filename(_opts) + "_threaded", {}, false);
+                if (_read_file(filename) != _read_file(threaded_filename))
+                    throw GridFormat::ValueError("Output written with multiple threads differs from '" + filename + "'");
+                std::filesystem::remove(threaded_filename);
+            }
         });
     }
 
@@ -141,6 +154,11 @@ class WriterTester {
         catch (const GridFormat::ValueError& e) {}
     }
 
+    static std::string _read_file(const std::string& filename) {
+        std::ifstream file{filename, std::ios::binary};
+        return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    }
+
     template<typename T>
     std::string _add_header_prec_suffix(const std::string& name, const Precision<T>& p) const {
         return name +"_headerprecision_" + _name(DynamicPrecision{p});
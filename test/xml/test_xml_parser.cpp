@@ -77,5 +77,31 @@ int main() {
         }
     };
 
+    const auto skip_appendix = [] (const GridFormat::XMLElement& e) { return e.name() == "Appendix"; };
+    const auto trimmed_content = [] (GridFormat::XMLParser& p, const GridFormat::XMLElement& e) {
+        auto content = p.read_content_for(e);
+        content = content.substr(content.find_first_not_of(" \t\n"));
+        return content.substr(0, content.find_last_not_of(" \t\n") + 1);
+    };
+
+    "xml_parser_skipped_trailing_content"_test = [&] () {
+        std::stringstream in;
+        in << "<root><header/><Appendix>\n_<no xml></Appendix nor this\n  </Appendix>\n";
+        in << "<!--comment--></root>\n";
+        GridFormat::XMLParser p{in, "ROOT", skip_appendix};
+        const auto& root = p.get_xml().get_child("root");
+        expect(root.has_child("header"));
+        expect(eq(trimmed_content(p, root.get_child("Appendix")), std::string{"_<no xml></Appendix nor this"}));
+    };
+
+    "xml_parser_skipped_content_followed_by_elements"_test = [&] () {
+        std::stringstream in;
+        in << "<root><Appendix>_<no xml></Appendix>\n<other>content</other></root>";
+        GridFormat::XMLParser p{in, "ROOT", skip_appendix};
+        const auto& root = p.get_xml().get_child("root");
+        expect(eq(trimmed_content(p, root.get_child("Appendix")), std::string{"_<no xml>"}));
+        expect(eq(trimmed_content(p, root.get_child("other")), std::string{"content"}));
+    };
+
     return 0;
 }